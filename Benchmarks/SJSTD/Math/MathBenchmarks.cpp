@@ -0,0 +1,697 @@
+// STD Headers
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+// Library Headers
+#include <benchmark/benchmark.h>
+
+// SJ Headers
+#include <ScrewjankStd/PlatformDetection.hpp>
+
+import sj.std.math;
+
+using namespace sj;
+
+/**
+ * Every benchmark runs twice: once through sj.std.math, compiled for the SJ_SIMD_ARCH the build
+ * was configured with, and once through a plain scalar reference. The reference doesn't change
+ * between configurations, so it's the common baseline when comparing builds.
+ * To compare SIMD levels directly, configure with -DSJ_SIMD_ARCH=Scalar, SSE4 and AVX2 and run
+ * each SjMathBenchmarks binary. The library's label says which paths it was compiled with.
+ */
+namespace math_benchmarks
+{
+constexpr size_t kBatchSize = 1024;
+
+constexpr const char* SimdLevelLabel()
+{
+    switch(g_SimdLevel)
+    {
+    case SimdLevel::AVX2:
+        return "sj.std.math (AVX2)";
+    case SimdLevel::SSE41:
+        return "sj.std.math (SSE4.1)";
+    case SimdLevel::Scalar:
+        return "sj.std.math (scalar)";
+    }
+    return "sj.std.math";
+}
+
+/**
+ * Straightforward scalar versions of the library's math, written the way code looks before it's
+ * vectorized by hand. Same row vector convention and algorithms as sj.std.math
+ */
+namespace reference
+{
+    using Float4 = std::array<float, 4>;
+    using Float44 = std::array<Float4, 4>;
+
+    Float4 ToFloat4(const Vec4& v)
+    {
+        return v.Data();
+    }
+
+    Float44 ToFloat44(const Mat44& m)
+    {
+        return {m.GetX().Data(), m.GetY().Data(), m.GetZ().Data(), m.GetW().Data()};
+    }
+
+    Float4 TransformVector(const Float4& v, const Float44& m)
+    {
+        Float4 res {};
+        for(int col = 0; col < 4; col++)
+        {
+            for(int row = 0; row < 4; row++)
+                res[col] += v[row] * m[row][col];
+        }
+        return res;
+    }
+
+    Float44 Multiply(const Float44& a, const Float44& b)
+    {
+        return {TransformVector(a[0], b),
+                TransformVector(a[1], b),
+                TransformVector(a[2], b),
+                TransformVector(a[3], b)};
+    }
+
+    float Dot(const Float4& a, const Float4& b)
+    {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    }
+
+    Float4 Normalize(const Float4& v)
+    {
+        const float invLength = 1.0f / std::sqrt(Dot(v, v));
+        return {v[0] * invLength, v[1] * invLength, v[2] * invLength, v[3] * invLength};
+    }
+
+    Float44 AffineInverse(const Float44& m)
+    {
+        Float44 res {};
+        for(int axis = 0; axis < 3; axis++)
+        {
+            const float invLengthSqr = 1.0f / Dot(m[axis], m[axis]);
+            for(int i = 0; i < 3; i++)
+                res[i][axis] = m[axis][i] * invLengthSqr;
+        }
+
+        for(int col = 0; col < 3; col++)
+        {
+            res[3][col] =
+                -(m[3][0] * res[0][col] + m[3][1] * res[1][col] + m[3][2] * res[2][col]);
+        }
+        res[3][3] = 1.0f;
+
+        return res;
+    }
+
+    Float44 FromEulerXYZ(const Vec3& eulers)
+    {
+        const float cx = std::cos(eulers.x);
+        const float sx = std::sin(eulers.x);
+        const float cy = std::cos(eulers.y);
+        const float sy = std::sin(eulers.y);
+        const float cz = std::cos(eulers.z);
+        const float sz = std::sin(eulers.z);
+
+        const Float44 x = {{{1, 0, 0, 0}, {0, cx, sx, 0}, {0, -sx, cx, 0}, {0, 0, 0, 1}}};
+        const Float44 y = {{{cy, 0, -sy, 0}, {0, 1, 0, 0}, {sy, 0, cy, 0}, {0, 0, 0, 1}}};
+        const Float44 z = {{{cz, sz, 0, 0}, {-sz, cz, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}}};
+
+        return Multiply(Multiply(x, y), z);
+    }
+
+    Float44 BuildTransform(const Float4& scale, const Vec3& eulers, const Float4& translation)
+    {
+        const Float44 s = {
+            {{scale[0], 0, 0, 0}, {0, scale[1], 0, 0}, {0, 0, scale[2], 0}, {0, 0, 0, 1}}};
+        const Float44 t = {{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}, translation}};
+
+        return Multiply(Multiply(s, FromEulerXYZ(eulers)), t);
+    }
+
+    /** Hamilton product, (x, y, z, w) with w the scalar part */
+    Float4 QuatMultiply(const Float4& a, const Float4& b)
+    {
+        return {a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1],
+                a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0],
+                a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3],
+                a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2]};
+    }
+
+    Float4 QuatFromEulerXYZ(const Vec3& eulers)
+    {
+        const Float4 x = {std::sin(eulers.x * 0.5f), 0, 0, std::cos(eulers.x * 0.5f)};
+        const Float4 y = {0, std::sin(eulers.y * 0.5f), 0, std::cos(eulers.y * 0.5f)};
+        const Float4 z = {0, 0, std::sin(eulers.z * 0.5f), std::cos(eulers.z * 0.5f)};
+
+        return QuatMultiply(QuatMultiply(z, y), x);
+    }
+
+    Float4 Slerp(const Float4& a, const Float4& b, float t)
+    {
+        Float4 to = b;
+        float cosTheta = Dot(a, b);
+        if(cosTheta < 0.0f)
+        {
+            for(float& element : to)
+                element = -element;
+            cosTheta = -cosTheta;
+        }
+
+        Float4 res;
+        if(cosTheta > 0.9995f)
+        {
+            for(int i = 0; i < 4; i++)
+                res[i] = a[i] + (to[i] - a[i]) * t;
+            return Normalize(res);
+        }
+
+        const float theta = std::acos(cosTheta);
+        const float invSinTheta = 1.0f / std::sin(theta);
+        const float fromWeight = std::sin((1.0f - t) * theta) * invSinTheta;
+        const float toWeight = std::sin(t * theta) * invSinTheta;
+
+        for(int i = 0; i < 4; i++)
+            res[i] = a[i] * fromWeight + to[i] * toWeight;
+        return res;
+    }
+} // namespace reference
+
+/**
+ * Each harness exposes the same operations over its own types, so every benchmark is written once
+ * and templated on the harness
+ */
+struct SjMathHarness
+{
+    static constexpr const char* kName = SimdLevelLabel();
+
+    using Vec4Type = Vec4;
+    using Mat44Type = Mat44;
+    using QuatType = Quat;
+    using FrustumType = Frustum;
+
+    static Vec4Type Convert(const Vec4& v)
+    {
+        return v;
+    }
+
+    static Mat44Type Convert(const Mat44& m)
+    {
+        return m;
+    }
+
+    static QuatType Convert(const Quat& q)
+    {
+        return q;
+    }
+
+    static FrustumType Convert(const Frustum& frustum)
+    {
+        return frustum;
+    }
+
+    static Mat44Type Multiply(const Mat44Type& a, const Mat44Type& b)
+    {
+        return a * b;
+    }
+
+    static Mat44Type AffineInverse(const Mat44Type& m)
+    {
+        return m.AffineInverse();
+    }
+
+    static Vec4Type Vec4Ops(const Vec4Type& a, const Vec4Type& b, float& inOutSum)
+    {
+        const Vec4 res = (a.Cross(b) + a * 0.5f).Normalize();
+        inOutSum += res.Dot(b);
+        return res;
+    }
+
+    static QuatType Slerp(const QuatType& a, const QuatType& b, float t)
+    {
+        return sj::Slerp(a, b, t);
+    }
+
+    static Mat44Type FromEulerXYZ(const Vec3& eulers)
+    {
+        return Mat44::FromEulerXYZ(eulers);
+    }
+
+    static QuatType QuatFromEulerXYZ(const Vec3& eulers)
+    {
+        return Quat::FromEulerXYZ(eulers);
+    }
+
+    static Mat44Type BuildTransform(const Vec4Type& scale,
+                                   const Vec3& eulers,
+                                   const Vec4Type& translation)
+    {
+        return sj::BuildTransform(scale, eulers, translation);
+    }
+
+    static void TransformPoints(std::span<const Vec3> points,
+                                const Mat44Type& transform,
+                                std::span<Vec3> out)
+    {
+        sj::TransformPoints(points, transform, out);
+    }
+
+    static size_t CullAABBs(const FrustumType& frustum,
+                            std::span<const AABB> boxes,
+                            std::span<uint32_t> outVisible)
+    {
+        return sj::CullAABBs(frustum, boxes, outVisible);
+    }
+};
+
+struct ReferenceHarness
+{
+    static constexpr const char* kName = "scalar reference";
+
+    using Vec4Type = reference::Float4;
+    using Mat44Type = reference::Float44;
+    using QuatType = reference::Float4;
+    using FrustumType = std::array<reference::Float4, 6>;
+
+    static Vec4Type Convert(const Vec4& v)
+    {
+        return reference::ToFloat4(v);
+    }
+
+    static Mat44Type Convert(const Mat44& m)
+    {
+        return reference::ToFloat44(m);
+    }
+
+    static QuatType Convert(const Quat& q)
+    {
+        return reference::ToFloat4(q.AsVec4());
+    }
+
+    static FrustumType Convert(const Frustum& frustum)
+    {
+        FrustumType planes;
+        for(size_t i = 0; i < planes.size(); i++)
+            planes[i] = reference::ToFloat4(frustum.planes[i]);
+        return planes;
+    }
+
+    static Mat44Type Multiply(const Mat44Type& a, const Mat44Type& b)
+    {
+        return reference::Multiply(a, b);
+    }
+
+    static Mat44Type AffineInverse(const Mat44Type& m)
+    {
+        return reference::AffineInverse(m);
+    }
+
+    static Vec4Type Vec4Ops(const Vec4Type& a, const Vec4Type& b, float& inOutSum)
+    {
+        const Vec4Type cross = {a[1] * b[2] - a[2] * b[1],
+                                a[2] * b[0] - a[0] * b[2],
+                                a[0] * b[1] - a[1] * b[0],
+                                0.0f};
+
+        const Vec4Type res = reference::Normalize({cross[0] + a[0] * 0.5f,
+                                                   cross[1] + a[1] * 0.5f,
+                                                   cross[2] + a[2] * 0.5f,
+                                                   cross[3] + a[3] * 0.5f});
+        inOutSum += reference::Dot(res, b);
+        return res;
+    }
+
+    static QuatType Slerp(const QuatType& a, const QuatType& b, float t)
+    {
+        return reference::Slerp(a, b, t);
+    }
+
+    static Mat44Type FromEulerXYZ(const Vec3& eulers)
+    {
+        return reference::FromEulerXYZ(eulers);
+    }
+
+    static QuatType QuatFromEulerXYZ(const Vec3& eulers)
+    {
+        return reference::QuatFromEulerXYZ(eulers);
+    }
+
+    static Mat44Type BuildTransform(const Vec4Type& scale,
+                                   const Vec3& eulers,
+                                   const Vec4Type& translation)
+    {
+        return reference::BuildTransform(scale, eulers, translation);
+    }
+
+    static void TransformPoints(std::span<const Vec3> points,
+                                const Mat44Type& transform,
+                                std::span<Vec3> out)
+    {
+        for(size_t i = 0; i < points.size(); i++)
+        {
+            const reference::Float4 res =
+                reference::TransformVector({points[i].x, points[i].y, points[i].z, 1.0f},
+                                           transform);
+            out[i] = {.x = res[0], .y = res[1], .z = res[2]};
+        }
+    }
+
+    static size_t CullAABBs(const FrustumType& planes,
+                            std::span<const AABB> boxes,
+                            std::span<uint32_t> outVisible)
+    {
+        size_t numVisible = 0;
+        for(size_t i = 0; i < boxes.size(); i++)
+        {
+            const AABB& box = boxes[i];
+
+            // The box is outside if its corner furthest along a plane's normal is behind it
+            bool isVisible = true;
+            for(const reference::Float4& plane : planes)
+            {
+                const float x = plane[0] >= 0.0f ? box.max.x : box.min.x;
+                const float y = plane[1] >= 0.0f ? box.max.y : box.min.y;
+                const float z = plane[2] >= 0.0f ? box.max.z : box.min.z;
+                if(plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.0f)
+                {
+                    isVisible = false;
+                    break;
+                }
+            }
+
+            if(isVisible)
+                outVisible[numVisible++] = static_cast<uint32_t>(i);
+        }
+        return numVisible;
+    }
+};
+
+/**
+ * Workload generation. Everything is built from sj types, then converted to the harness's own
+ */
+std::mt19937& Rng()
+{
+    static std::mt19937 rng(1337);
+    return rng;
+}
+
+float RandomFloat(float min, float max)
+{
+    return std::uniform_real_distribution<float>(min, max)(Rng());
+}
+
+Vec3 RandomVec3(float min, float max)
+{
+    return {RandomFloat(min, max), RandomFloat(min, max), RandomFloat(min, max)};
+}
+
+Vec3 RandomEulers()
+{
+    return RandomVec3(-std::numbers::pi_v<float>, std::numbers::pi_v<float>);
+}
+
+Vec4 RandomVec4()
+{
+    return {RandomFloat(-1, 1), RandomFloat(-1, 1), RandomFloat(-1, 1), RandomFloat(-1, 1)};
+}
+
+/** Scale, rotation and translation, so AffineInverse is valid */
+Mat44 RandomTransform()
+{
+    const Vec3 scale = RandomVec3(0.5f, 2.0f);
+    return BuildTransform(Vec4(scale, 0.0f), RandomEulers(), Vec4(RandomVec3(-100, 100), 1.0f));
+}
+
+template <class Harness, class T, class Generator>
+auto MakeBatch(size_t count, Generator&& generate)
+{
+    std::vector<decltype(Harness::Convert(std::declval<T>()))> batch;
+    batch.reserve(count);
+    for(size_t i = 0; i < count; i++)
+        batch.push_back(Harness::Convert(T(generate())));
+    return batch;
+}
+
+template <class Harness>
+void BM_Mat44Multiply(benchmark::State& state)
+{
+    const auto lhs = MakeBatch<Harness, Mat44>(kBatchSize, RandomTransform);
+    const auto rhs = MakeBatch<Harness, Mat44>(kBatchSize, RandomTransform);
+    std::vector<typename Harness::Mat44Type> out(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+            out[i] = Harness::Multiply(lhs[i], rhs[i]);
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+template <class Harness>
+void BM_AffineInverse(benchmark::State& state)
+{
+    const auto transforms = MakeBatch<Harness, Mat44>(kBatchSize, RandomTransform);
+    std::vector<typename Harness::Mat44Type> out(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+            out[i] = Harness::AffineInverse(transforms[i]);
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+/**
+ * Cross, scale, add, normalize and dot: the mix gameplay and physics code leans on
+ */
+template <class Harness>
+void BM_Vec4Ops(benchmark::State& state)
+{
+    const auto a = MakeBatch<Harness, Vec4>(kBatchSize, RandomVec4);
+    const auto b = MakeBatch<Harness, Vec4>(kBatchSize, RandomVec4);
+    std::vector<typename Harness::Vec4Type> out(kBatchSize);
+
+    for(auto _ : state)
+    {
+        float sum = 0.0f;
+        for(size_t i = 0; i < kBatchSize; i++)
+            out[i] = Harness::Vec4Ops(a[i], b[i], sum);
+
+        benchmark::DoNotOptimize(sum);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+template <class Harness>
+void BM_QuatSlerp(benchmark::State& state)
+{
+    auto randomRotation = [] { return Quat::FromEulerXYZ(RandomEulers()); };
+    const auto from = MakeBatch<Harness, Quat>(kBatchSize, randomRotation);
+    const auto to = MakeBatch<Harness, Quat>(kBatchSize, randomRotation);
+    std::vector<typename Harness::QuatType> out(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+            out[i] = Harness::Slerp(from[i], to[i], static_cast<float>(i) / kBatchSize);
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+template <class Harness>
+void BM_BuildTransform(benchmark::State& state)
+{
+    const auto scales =
+        MakeBatch<Harness, Vec4>(kBatchSize, [] { return Vec4(RandomVec3(0.5f, 2.0f), 0.0f); });
+    const auto translations =
+        MakeBatch<Harness, Vec4>(kBatchSize, [] { return Vec4(RandomVec3(-100, 100), 1.0f); });
+    std::vector<Vec3> eulers(kBatchSize);
+    for(Vec3& euler : eulers)
+        euler = RandomEulers();
+
+    std::vector<typename Harness::Mat44Type> out(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+            out[i] = Harness::BuildTransform(scales[i], eulers[i], translations[i]);
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+template <class Harness>
+void BM_Mat44FromEulerXYZ(benchmark::State& state)
+{
+    std::vector<Vec3> eulers(kBatchSize);
+    for(Vec3& euler : eulers)
+        euler = RandomEulers();
+
+    std::vector<typename Harness::Mat44Type> out(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+            out[i] = Harness::FromEulerXYZ(eulers[i]);
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+template <class Harness>
+void BM_QuatFromEulerXYZ(benchmark::State& state)
+{
+    std::vector<Vec3> eulers(kBatchSize);
+    for(Vec3& euler : eulers)
+        euler = RandomEulers();
+
+    std::vector<typename Harness::QuatType> out(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+            out[i] = Harness::QuatFromEulerXYZ(eulers[i]);
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+/**
+ * Batch point transform. Sizes span L1 resident batches through ones that stream from memory
+ */
+template <class Harness>
+void BM_TransformPoints(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+    const auto transform = Harness::Convert(RandomTransform());
+
+    std::vector<Vec3> points(count);
+    for(Vec3& point : points)
+        point = RandomVec3(-100, 100);
+
+    std::vector<Vec3> out(count);
+
+    for(auto _ : state)
+    {
+        Harness::TransformPoints(points, transform, out);
+
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(count * sizeof(Vec3) * 2));
+    state.SetLabel(Harness::kName);
+}
+
+/**
+ * Frustum culling with roughly a quarter of the boxes visible
+ */
+template <class Harness>
+void BM_CullAABBs(benchmark::State& state)
+{
+    const auto count = static_cast<size_t>(state.range(0));
+
+    // Camera at the origin looking down -z, 90 degree FOV, reversed Z
+    Mat44 projection;
+    projection.Set<0, 0>(1.0f);
+    projection.Set<1, 1>(1.0f);
+    projection.Set<2, 2>(0.1f / (1000.0f - 0.1f));
+    projection.Set<2, 3>(-1.0f);
+    projection.Set<3, 2>((1000.0f * 0.1f) / (1000.0f - 0.1f));
+    const auto frustum = Harness::Convert(Frustum::FromViewProjection(projection));
+
+    std::vector<AABB> boxes(count);
+    for(AABB& box : boxes)
+    {
+        const Vec3 center = RandomVec3(-200, 200);
+        const Vec3 extents = RandomVec3(0.1f, 5.0f);
+        box = {.min = {center.x - extents.x, center.y - extents.y, center.z - extents.z},
+               .max = {center.x + extents.x, center.y + extents.y, center.z + extents.z}};
+    }
+
+    std::vector<uint32_t> visible(count);
+
+    for(auto _ : state)
+    {
+        size_t numVisible = Harness::CullAABBs(frustum, boxes, visible);
+
+        benchmark::DoNotOptimize(numVisible);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+    state.SetLabel(Harness::kName);
+}
+
+void BatchSizes(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("count");
+    bench->RangeMultiplier(8)->Range(64, 1 << 18);
+}
+
+// Matrices
+BENCHMARK_TEMPLATE(BM_Mat44Multiply, ReferenceHarness);
+BENCHMARK_TEMPLATE(BM_Mat44Multiply, SjMathHarness);
+BENCHMARK_TEMPLATE(BM_AffineInverse, ReferenceHarness);
+BENCHMARK_TEMPLATE(BM_AffineInverse, SjMathHarness);
+BENCHMARK_TEMPLATE(BM_BuildTransform, ReferenceHarness);
+BENCHMARK_TEMPLATE(BM_BuildTransform, SjMathHarness);
+BENCHMARK_TEMPLATE(BM_Mat44FromEulerXYZ, ReferenceHarness);
+BENCHMARK_TEMPLATE(BM_Mat44FromEulerXYZ, SjMathHarness);
+
+// Vectors and quaternions
+BENCHMARK_TEMPLATE(BM_Vec4Ops, ReferenceHarness);
+BENCHMARK_TEMPLATE(BM_Vec4Ops, SjMathHarness);
+BENCHMARK_TEMPLATE(BM_QuatSlerp, ReferenceHarness);
+BENCHMARK_TEMPLATE(BM_QuatSlerp, SjMathHarness);
+BENCHMARK_TEMPLATE(BM_QuatFromEulerXYZ, ReferenceHarness);
+BENCHMARK_TEMPLATE(BM_QuatFromEulerXYZ, SjMathHarness);
+
+// Batches
+BENCHMARK_TEMPLATE(BM_TransformPoints, ReferenceHarness)->Apply(BatchSizes);
+BENCHMARK_TEMPLATE(BM_TransformPoints, SjMathHarness)->Apply(BatchSizes);
+BENCHMARK_TEMPLATE(BM_CullAABBs, ReferenceHarness)->Apply(BatchSizes);
+BENCHMARK_TEMPLATE(BM_CullAABBs, SjMathHarness)->Apply(BatchSizes);
+
+} // namespace math_benchmarks
@@ -0,0 +1,497 @@
+// STD Headers
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <span>
+#include <vector>
+
+// Library Headers
+#include <benchmark/benchmark.h>
+
+import sj.std.memory.resources;
+import sj.std.memory.literals;
+
+using namespace sj;
+
+namespace memory_benchmarks
+{
+constexpr size_t kArenaSize = 64_MiB;
+constexpr size_t kBatchSize = 4096;
+constexpr size_t kPoolBlockSize = 256;
+
+/**
+ * How a resource expects its allocations to be released
+ */
+enum class FreePolicy
+{
+    kAnyOrder, // Individual frees in any order
+    kLifo, // Individual frees in reverse allocation order only
+    kBulkReset // No individual frees, the whole resource is reset
+};
+
+/**
+ * Each harness owns one resource plus the memory backing it, and describes how it may be used.
+ * Benchmarks are templated on the harness so every resource runs the same workload.
+ */
+struct FreeListHarness
+{
+    static constexpr const char* kName = "free_list_allocator";
+    static constexpr FreePolicy kFreePolicy = FreePolicy::kAnyOrder;
+    static constexpr size_t kMaxAllocSize = std::numeric_limits<size_t>::max();
+
+    FreeListHarness() : buffer(kArenaSize)
+    {
+        resource.init(kArenaSize, buffer.data());
+    }
+
+    void reset()
+    {
+    }
+
+    std::vector<std::byte> buffer;
+    free_list_allocator resource;
+};
+
+struct PoolHarness
+{
+    static constexpr const char* kName = "pool_allocator";
+    static constexpr FreePolicy kFreePolicy = FreePolicy::kAnyOrder;
+    static constexpr size_t kMaxAllocSize = kPoolBlockSize;
+
+    PoolHarness() : buffer(kArenaSize / 16)
+    {
+        resource.init(buffer.size(), buffer.data());
+    }
+
+    void reset()
+    {
+    }
+
+    std::vector<std::byte> buffer;
+    pool_allocator<kPoolBlockSize> resource;
+};
+
+struct StackHarness
+{
+    static constexpr const char* kName = "stack_allocator";
+    static constexpr FreePolicy kFreePolicy = FreePolicy::kLifo;
+    static constexpr size_t kMaxAllocSize = std::numeric_limits<size_t>::max();
+
+    StackHarness() : buffer(kArenaSize)
+    {
+        resource.init(kArenaSize, buffer.data());
+    }
+
+    void reset()
+    {
+    }
+
+    std::vector<std::byte> buffer;
+    stack_allocator resource;
+};
+
+struct LinearHarness
+{
+    static constexpr const char* kName = "linear_allocator";
+    static constexpr FreePolicy kFreePolicy = FreePolicy::kBulkReset;
+    static constexpr size_t kMaxAllocSize = std::numeric_limits<size_t>::max();
+
+    LinearHarness() : buffer(kArenaSize)
+    {
+        resource.init(kArenaSize, buffer.data());
+    }
+
+    void reset()
+    {
+        resource.reset();
+    }
+
+    std::vector<std::byte> buffer;
+    linear_allocator resource;
+};
+
+struct SystemHarness
+{
+    static constexpr const char* kName = "system_allocator";
+    static constexpr FreePolicy kFreePolicy = FreePolicy::kAnyOrder;
+    static constexpr size_t kMaxAllocSize = std::numeric_limits<size_t>::max();
+
+    void reset()
+    {
+    }
+
+    system_allocator resource;
+};
+
+struct PmrPoolHarness
+{
+    static constexpr const char* kName = "std::pmr::unsynchronized_pool_resource";
+    static constexpr FreePolicy kFreePolicy = FreePolicy::kAnyOrder;
+    static constexpr size_t kMaxAllocSize = std::numeric_limits<size_t>::max();
+
+    void reset()
+    {
+    }
+
+    std::pmr::unsynchronized_pool_resource resource {std::pmr::new_delete_resource()};
+};
+
+struct PmrMonotonicHarness
+{
+    static constexpr const char* kName = "std::pmr::monotonic_buffer_resource";
+    static constexpr FreePolicy kFreePolicy = FreePolicy::kBulkReset;
+    static constexpr size_t kMaxAllocSize = std::numeric_limits<size_t>::max();
+
+    PmrMonotonicHarness()
+        : buffer(kArenaSize),
+          resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource())
+    {
+    }
+
+    void reset()
+    {
+        resource.release();
+    }
+
+    std::vector<std::byte> buffer;
+    std::pmr::monotonic_buffer_resource resource;
+};
+
+/**
+ * Allocation size distributions
+ */
+enum class SizeDistribution : int64_t
+{
+    kSmall, // Uniform 8 - 64 bytes, e.g. nodes and small strings
+    kGame, // Mostly small objects with a tail of medium buffers and rare large ones
+    kFixed // Every request is kPoolBlockSize
+};
+
+std::vector<size_t> MakeSizes(SizeDistribution distribution, size_t count, size_t maxSize)
+{
+    std::mt19937 rng(1337);
+    std::vector<size_t> sizes(count);
+
+    for(size_t& size : sizes)
+    {
+        switch(distribution)
+        {
+        case SizeDistribution::kSmall:
+            size = std::uniform_int_distribution<size_t>(8, 64)(rng);
+            break;
+        case SizeDistribution::kGame:
+        {
+            const int bucket = std::uniform_int_distribution<int>(0, 99)(rng);
+            if(bucket < 70)
+                size = std::uniform_int_distribution<size_t>(16, 128)(rng);
+            else if(bucket < 95)
+                size = std::uniform_int_distribution<size_t>(128, 1024)(rng);
+            else
+                size = std::uniform_int_distribution<size_t>(1024, 16384)(rng);
+            break;
+        }
+        case SizeDistribution::kFixed:
+            size = kPoolBlockSize;
+            break;
+        }
+
+        // Fixed size resources service the clamped request
+        size = std::min(size, maxSize);
+    }
+
+    return sizes;
+}
+
+std::vector<size_t> MakeShuffledOrder(size_t count)
+{
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(4242));
+    return order;
+}
+
+template <class Harness>
+void ReleaseBatch(Harness& harness, std::span<void*> ptrs, std::span<const size_t> sizes)
+{
+    if constexpr(Harness::kFreePolicy == FreePolicy::kBulkReset)
+    {
+        harness.reset();
+    }
+    else
+    {
+        // LIFO is valid for every resource that supports individual frees
+        for(size_t i = ptrs.size(); i-- > 0;)
+            harness.resource.deallocate(ptrs[i], sizes[i]);
+    }
+}
+
+void SetPercentileCounters(benchmark::State& state, std::vector<int64_t>& samples)
+{
+    if(samples.empty())
+        return;
+
+    std::ranges::sort(samples);
+    auto percentile = [&samples](double p) {
+        const auto index = static_cast<size_t>(p * static_cast<double>(samples.size() - 1));
+        return static_cast<double>(samples[index]);
+    };
+
+    state.counters["p50_ns"] = percentile(0.50);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["p999_ns"] = percentile(0.999);
+    state.counters["max_ns"] = static_cast<double>(samples.back());
+}
+
+/**
+ * Allocate a batch then release it in the cheapest order the resource supports
+ */
+template <class Harness>
+void BM_BatchAllocFree(benchmark::State& state)
+{
+    Harness harness;
+    const auto distribution = static_cast<SizeDistribution>(state.range(0));
+    const std::vector<size_t> sizes =
+        MakeSizes(distribution, kBatchSize, Harness::kMaxAllocSize);
+    std::vector<void*> ptrs(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+        {
+            ptrs[i] = harness.resource.allocate(sizes[i]);
+            benchmark::DoNotOptimize(ptrs[i]);
+        }
+
+        ReleaseBatch(harness, ptrs, sizes);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+/**
+ * Allocate a batch then free it in a random order. Only valid for kAnyOrder resources
+ */
+template <class Harness>
+void BM_RandomOrderFree(benchmark::State& state)
+{
+    static_assert(Harness::kFreePolicy == FreePolicy::kAnyOrder);
+
+    Harness harness;
+    const auto distribution = static_cast<SizeDistribution>(state.range(0));
+    const std::vector<size_t> sizes =
+        MakeSizes(distribution, kBatchSize, Harness::kMaxAllocSize);
+    const std::vector<size_t> freeOrder = MakeShuffledOrder(kBatchSize);
+    std::vector<void*> ptrs(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+            ptrs[i] = harness.resource.allocate(sizes[i]);
+
+        for(size_t index : freeOrder)
+            harness.resource.deallocate(ptrs[index], sizes[index]);
+
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+/**
+ * Fill the resource, free a random half to punch holes, then time allocations that are larger
+ * than most of the holes. Exposes search cost and coalescing behaviour.
+ */
+template <class Harness>
+void BM_Fragmentation(benchmark::State& state)
+{
+    static_assert(Harness::kFreePolicy == FreePolicy::kAnyOrder);
+
+    Harness harness;
+    const std::vector<size_t> sizes =
+        MakeSizes(SizeDistribution::kGame, kBatchSize, Harness::kMaxAllocSize);
+    const std::vector<size_t> freeOrder = MakeShuffledOrder(kBatchSize);
+    std::vector<void*> ptrs(kBatchSize);
+    std::vector<void*> largePtrs(kBatchSize / 2);
+
+    const size_t largeSize = std::min<size_t>(2048, Harness::kMaxAllocSize);
+
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        for(size_t i = 0; i < kBatchSize; i++)
+            ptrs[i] = harness.resource.allocate(sizes[i]);
+
+        for(size_t i = 0; i < kBatchSize / 2; i++)
+            harness.resource.deallocate(ptrs[freeOrder[i]], sizes[freeOrder[i]]);
+        state.ResumeTiming();
+
+        for(void*& ptr : largePtrs)
+        {
+            ptr = harness.resource.allocate(largeSize);
+            benchmark::DoNotOptimize(ptr);
+        }
+
+        state.PauseTiming();
+        for(void* ptr : largePtrs)
+            harness.resource.deallocate(ptr, largeSize);
+
+        for(size_t i = kBatchSize / 2; i < kBatchSize; i++)
+            harness.resource.deallocate(ptrs[freeOrder[i]], sizes[freeOrder[i]]);
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(largePtrs.size()));
+    state.SetLabel(Harness::kName);
+}
+
+/**
+ * Times every allocate call individually and reports latency percentiles as counters
+ */
+template <class Harness>
+void BM_AllocLatency(benchmark::State& state)
+{
+    using Clock = std::chrono::steady_clock;
+
+    Harness harness;
+    const auto distribution = static_cast<SizeDistribution>(state.range(0));
+    const std::vector<size_t> sizes =
+        MakeSizes(distribution, kBatchSize, Harness::kMaxAllocSize);
+    std::vector<void*> ptrs(kBatchSize);
+
+    std::vector<int64_t> samples;
+    samples.reserve(kBatchSize * 64);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+        {
+            const auto start = Clock::now();
+            ptrs[i] = harness.resource.allocate(sizes[i]);
+            const auto end = Clock::now();
+
+            benchmark::DoNotOptimize(ptrs[i]);
+            if(samples.size() < samples.capacity())
+                samples.push_back(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        }
+
+        ReleaseBatch(harness, ptrs, sizes);
+    }
+
+    SetPercentileCounters(state, samples);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+/**
+ * Every thread owns its own resource, the pattern sj resources are designed around
+ */
+template <class Harness>
+void BM_ThreadLocalMix(benchmark::State& state)
+{
+    Harness harness;
+    const std::vector<size_t> sizes =
+        MakeSizes(SizeDistribution::kGame, kBatchSize, Harness::kMaxAllocSize);
+    std::vector<void*> ptrs(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+            ptrs[i] = harness.resource.allocate(sizes[i]);
+
+        ReleaseBatch(harness, ptrs, sizes);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+    state.SetLabel(Harness::kName);
+}
+
+/**
+ * All threads share one thread-safe resource
+ */
+template <class Resource>
+void BM_SharedMix(benchmark::State& state)
+{
+    static Resource* s_resource = nullptr;
+    if(state.thread_index() == 0)
+        s_resource = new Resource();
+
+    const std::vector<size_t> sizes =
+        MakeSizes(SizeDistribution::kGame, kBatchSize, std::numeric_limits<size_t>::max());
+    std::vector<void*> ptrs(kBatchSize);
+
+    for(auto _ : state)
+    {
+        for(size_t i = 0; i < kBatchSize; i++)
+            ptrs[i] = s_resource->allocate(sizes[i]);
+
+        for(size_t i = kBatchSize; i-- > 0;)
+            s_resource->deallocate(ptrs[i], sizes[i]);
+
+        benchmark::ClobberMemory();
+    }
+
+    if(state.thread_index() == 0)
+    {
+        delete s_resource;
+        s_resource = nullptr;
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(kBatchSize));
+}
+
+void AllDistributions(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("distribution");
+    bench->Arg(static_cast<int64_t>(SizeDistribution::kSmall));
+    bench->Arg(static_cast<int64_t>(SizeDistribution::kGame));
+    bench->Arg(static_cast<int64_t>(SizeDistribution::kFixed));
+}
+
+// Batch alloc/free
+BENCHMARK_TEMPLATE(BM_BatchAllocFree, FreeListHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_BatchAllocFree, PoolHarness)->Arg(int64_t(SizeDistribution::kFixed));
+BENCHMARK_TEMPLATE(BM_BatchAllocFree, StackHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_BatchAllocFree, LinearHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_BatchAllocFree, SystemHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_BatchAllocFree, PmrPoolHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_BatchAllocFree, PmrMonotonicHarness)->Apply(AllDistributions);
+
+// Random free order
+BENCHMARK_TEMPLATE(BM_RandomOrderFree, FreeListHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_RandomOrderFree, PoolHarness)->Arg(int64_t(SizeDistribution::kFixed));
+BENCHMARK_TEMPLATE(BM_RandomOrderFree, SystemHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_RandomOrderFree, PmrPoolHarness)->Apply(AllDistributions);
+
+// Fragmentation
+BENCHMARK_TEMPLATE(BM_Fragmentation, FreeListHarness);
+BENCHMARK_TEMPLATE(BM_Fragmentation, SystemHarness);
+BENCHMARK_TEMPLATE(BM_Fragmentation, PmrPoolHarness);
+
+// Latency percentiles
+BENCHMARK_TEMPLATE(BM_AllocLatency, FreeListHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_AllocLatency, PoolHarness)->Arg(int64_t(SizeDistribution::kFixed));
+BENCHMARK_TEMPLATE(BM_AllocLatency, StackHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_AllocLatency, LinearHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_AllocLatency, SystemHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_AllocLatency, PmrPoolHarness)->Apply(AllDistributions);
+BENCHMARK_TEMPLATE(BM_AllocLatency, PmrMonotonicHarness)->Apply(AllDistributions);
+
+// Multi-threaded: per-thread resources against shared thread-safe ones
+BENCHMARK_TEMPLATE(BM_ThreadLocalMix, FreeListHarness)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadLocalMix, LinearHarness)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadLocalMix, PmrPoolHarness)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SharedMix, system_allocator)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SharedMix, std::pmr::synchronized_pool_resource)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+} // namespace memory_benchmarks
@@ -104,4 +104,17 @@ FetchContent_Declare(
 )
 # For Windows: Prevent overriding the parent project's compiler/linker settings
 set(gtest_force_shared_crt ON CACHE BOOL "" FORCE)
-FetchContent_MakeAvailable(googletest)
\ No newline at end of file
+FetchContent_MakeAvailable(googletest)
+
+## Google Benchmark
+if(SJ_BUILD_BENCHMARKS)
+    FetchContent_Declare(
+      benchmark
+      SYSTEM
+      GIT_REPOSITORY https://github.com/google/benchmark.git
+      GIT_TAG v1.9.4
+    )
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+    FetchContent_MakeAvailable(benchmark)
+endif()
@@ -11,7 +11,8 @@ enum class AssetType : uint8_t
 {
     kInvalid,
     kTexture,
-    kMesh
+    kMesh,
+    kOccluder
 };
 
 template <class T>
@@ -24,10 +24,32 @@ export namespace sj
 
     struct MeshHeader
     {
+        /** Bumped whenever the layout changes, so stale .sj_mesh files are caught on load */
+        static constexpr uint16_t kVersion = 2;
+
         AssetType type = AssetType::kMesh;
+        uint16_t version = kVersion;
         uint8_t indexSize = 0;
         uint32_t numVerts = 0;
         uint32_t numIndices = 0;
+
+        /** Model space bounds of every vertex position, computed at build time */
+        AABB bounds = {};
+    };
+
+    /**
+     * Low poly occlusion proxy of a mesh, built next to its .sj_mesh.
+     * Followed by numVerts Vec3 positions and numIndices uint16_t triangle list indices
+     */
+    struct OccluderHeader
+    {
+        /** Bumped whenever the layout changes, so stale .sj_occluder files are caught on load */
+        static constexpr uint16_t kVersion = 1;
+
+        AssetType type = AssetType::kOccluder;
+        uint16_t version = kVersion;
+        uint32_t numVerts = 0;
+        uint32_t numIndices = 0;
     };
 } // namespace sj
 
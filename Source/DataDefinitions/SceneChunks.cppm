@@ -16,7 +16,7 @@ export namespace sj
 struct GameObjectChunk
 {
     hashed_string_sv id;
-    sj::dynamic_vector<DataChunk> components;
+    sj::small_vector<DataChunk, 4> components; // Most game objects carry a handful of components
 };
 
 struct SceneChunk
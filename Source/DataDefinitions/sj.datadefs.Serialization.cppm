@@ -2,10 +2,12 @@ module;
 
 #include <glaze/glaze.hpp>
 
+#include <array>
 #include <string_view>
 
 export module sj.datadefs.Serialization;
 import sj.std.string_hash;
+import sj.std.string_pool;
 import sj.std.math;
 
 export namespace glz
@@ -55,7 +57,8 @@ struct from<JSON, sj::hashed_string_sv>
         std::string_view str;
         glz::parse<JSON>::op<Opts>(str, ctx, it, end);
 
-        strHash = sj::hashed_string_sv(str);
+        // str views the document being parsed, which is usually freed once loading finishes
+        strHash = sj::string_pool::global().intern(str);
     }
 };
 
@@ -172,6 +175,59 @@ struct from<JSON, sj::Mat44>
     }
 };
 
+template <>
+struct from<JSON, sj::Transform>
+{
+    template <auto Opts>
+    static void op(sj::Transform& transform, auto&&... args)
+    {
+        struct TransformLayout
+        {
+            sj::Vec3 translation;
+            sj::Vec3 rotation;
+            sj::Vec3 scale;
+        } layout;
+
+        glz::parse<JSON>::op<Opts>(layout, args...);
+
+        layout.rotation.x = sj::ToRadians(layout.rotation.x);
+        layout.rotation.y = sj::ToRadians(layout.rotation.y);
+        layout.rotation.z = sj::ToRadians(layout.rotation.z);
+
+        transform = sj::Transform::FromEulerXYZ(layout.translation, layout.rotation, layout.scale);
+    }
+};
+
+template <>
+struct to<BEVE, sj::Transform>
+{
+    template <auto Opts>
+    static void op(const sj::Transform& transform, auto&&... args)
+    {
+        const sj::Vec3& t = transform.translation;
+        const sj::Quat& r = transform.rotation;
+        const sj::Vec3& s = transform.scale;
+
+        std::array<float, 10> data = {t.x, t.y, t.z, r[0], r[1], r[2], r[3], s.x, s.y, s.z};
+        glz::serialize<BEVE>::op<Opts>(data, args...);
+    }
+};
+
+template <>
+struct from<BEVE, sj::Transform>
+{
+    template <auto Opts>
+    static void op(sj::Transform& transform, auto&&... args)
+    {
+        std::array<float, 10> data = {};
+        glz::parse<BEVE>::op<Opts>(data, args...);
+
+        transform = {.translation = {.x = data[0], .y = data[1], .z = data[2]},
+                     .rotation = sj::Quat(data[3], data[4], data[5], data[6]),
+                     .scale = {.x = data[7], .y = data[8], .z = data[9]}};
+    }
+};
+
 template <>
 struct to<BEVE, sj::Mat44>
 {
@@ -48,6 +48,9 @@ struct Config
     std::string default_scene;
     Vec2 window_size;
     InputBindings input_bindings;
+
+    /** Render frame N on a dedicated thread while simulating frame N+1. Adds a frame of latency */
+    bool pipelined_rendering = false;
 };
 
 Config LoadConfig()
@@ -0,0 +1,52 @@
+module;
+
+#include <ScrewjankStd/Assert.hpp>
+
+#include <fstream>
+#include <string>
+#include <string_view>
+
+export module sj.engine.core.BoundsComponent;
+import sj.datadefs.DataChunk;
+import sj.datadefs.assets.Mesh;
+import sj.std.math;
+import sj.engine.ecs.ECSRegistry;
+import sj.engine.ecs.Identifiers;
+import sj.engine.ecs.Serialization;
+
+export namespace sj
+{
+struct BoundsComponent
+{
+    /** Model space bounds, relative to the game object's TransformComponent */
+    AABB localBounds;
+};
+
+struct BoundsChunk
+{
+    std::string_view mesh_path;
+};
+
+/**
+ * Bounds come from the .sj_mesh header, so only the header is read here
+ */
+template <>
+void LoadComponent<BoundsComponent>(ECSRegistry& registry,
+                                    GameObjectId goId,
+                                    const DataChunk& componentData)
+{
+    auto chunk = componentData.Get<BoundsChunk>();
+
+    std::ifstream file(std::string(chunk.mesh_path), std::ios::binary);
+    SJ_ASSERT(file.is_open(), "Failed to open mesh {}", chunk.mesh_path);
+
+    MeshHeader header = {};
+    file.read(reinterpret_cast<char*>(&header), sizeof(MeshHeader));
+    SJ_ASSERT(header.type == AssetType::kMesh, "Invalid mesh load");
+    SJ_ASSERT(header.version == MeshHeader::kVersion,
+              "Stale mesh {}, rebuild assets",
+              chunk.mesh_path);
+
+    registry.CreateComponent<BoundsComponent>(goId, header.bounds);
+};
+} // namespace sj
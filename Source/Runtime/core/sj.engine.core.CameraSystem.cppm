@@ -23,24 +23,27 @@ export namespace sj
             for(const auto& [goId, cameraComponent] : components )
             {
                 // TODO: What if there's multiple
-                Mat44 localToGoTransform = cameraComponent.localToGoTransform;
+                const Transform& localToGoTransform = cameraComponent.localToGoTransform;
                 const TransformComponent* goTransform = registry.GetComponent<TransformComponent>(goId);              
-                const Mat44& goWorldSpaceTransform = goTransform->localToParentTransform;
-                
-                Mat44 outputTransform = localToGoTransform * goWorldSpaceTransform;
-                
-                m_outputCameraMatrix = outputTransform;
+                const Transform& goWorldSpaceTransform = goTransform->localToParentTransform;
+
+                m_outputCameraTransform = localToGoTransform * goWorldSpaceTransform;
 
                 break;
             }
         }
 
+        [[nodiscard]] const Transform& GetOutputCameraTransform() const
+        {
+            return m_outputCameraTransform;
+        }
+
         [[nodiscard]] Mat44 GetOutputCameraMatrix() const
         {
-            return m_outputCameraMatrix;
+            return m_outputCameraTransform.ToMat44();
         }
 
     private:
-        Mat44 m_outputCameraMatrix = Mat44(kIdentityTag);
+        Transform m_outputCameraTransform;
     };
 } // namespace sj
\ No newline at end of file
@@ -0,0 +1,68 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+export module sj.engine.core.CullingSystem;
+import sj.engine.core.BoundsComponent;
+import sj.engine.core.TransformComponent;
+
+import sj.std.containers.vector;
+import sj.std.math;
+import sj.engine.ecs.ECSRegistry;
+import sj.engine.ecs.Identifiers;
+
+export namespace sj
+{
+    /**
+     * Decides which game objects with a BoundsComponent are inside the camera frustum.
+     * Doesn't touch the renderer, so it runs headless
+     */
+    class CullingSystem
+    {
+    public:
+        /**
+         * @param viewProjection World to clip space matrix of the camera being culled against
+         */
+        void Process(ECSRegistry& registry, const Mat44& viewProjection)
+        {
+            m_gameObjects.clear();
+            m_worldBounds.clear();
+
+            for(const auto& [goId, boundsComponent] : registry.GetComponents<BoundsComponent>())
+            {
+                const TransformComponent* transform =
+                    registry.GetComponent<TransformComponent>(goId);
+                if(transform == nullptr)
+                    continue;
+
+                m_gameObjects.push_back(goId);
+                m_worldBounds.push_back(TransformAABB(boundsComponent.localBounds,
+                                                      transform->localToParentTransform.ToMat44()));
+            }
+
+            m_visibleIndices.resize(m_worldBounds.size());
+            const size_t numVisible = CullAABBs(Frustum::FromViewProjection(viewProjection),
+                                                m_worldBounds,
+                                                m_visibleIndices);
+
+            m_visibleGameObjects.clear();
+            for(size_t i = 0; i < numVisible; i++)
+                m_visibleGameObjects.push_back(m_gameObjects[m_visibleIndices[i]]);
+        }
+
+        /** Game objects that passed the last Process, in component order */
+        [[nodiscard]] std::span<const GameObjectId> GetVisibleGameObjects() const
+        {
+            return m_visibleGameObjects;
+        }
+
+    private:
+        // Kept between frames so steady state culling doesn't allocate
+        dynamic_vector<GameObjectId> m_gameObjects;
+        dynamic_vector<AABB> m_worldBounds;
+        dynamic_vector<uint32_t> m_visibleIndices;
+        dynamic_vector<GameObjectId> m_visibleGameObjects;
+    };
+} // namespace sj
@@ -0,0 +1,545 @@
+module;
+
+#include <ScrewjankStd/Assert.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+export module sj.engine.core.DynamicBVH;
+import sj.std.containers.vector;
+import sj.std.math;
+import sj.engine.ecs.Identifiers;
+
+export namespace sj
+{
+    /**
+     * Dynamic AABB tree keyed by GameObjectId, for queries that would otherwise test every object.
+     *
+     * Leaves keep a fattened copy of each box so small movements don't touch the tree. New leaves
+     * are placed with a surface area heuristic, and ancestors are refit and rotated on the way
+     * back up to keep the tree balanced under incremental updates.
+     *
+     * Queries write into caller provided buffers (e.g. a scratchpad array) and return the total
+     * number of results. That can exceed the buffer's size, in which case only the first
+     * out.size() results are written
+     */
+    class DynamicBVH
+    {
+    public:
+        struct RayHit
+        {
+            GameObjectId goId;
+
+            /** Ray parameter of the entry point, in multiples of the ray direction */
+            float distance = 0.0f;
+        };
+
+        /**
+         * @param margin How far leaf boxes are fattened on each side
+         */
+        explicit DynamicBVH(float margin = 0.1f) : m_margin(margin)
+        {
+        }
+
+        void Insert(GameObjectId goId, const AABB& bounds)
+        {
+            if(goId.sparseIndex >= m_leaves.size())
+                m_leaves.resize(goId.sparseIndex + 1, kNullNode);
+
+            // The slot may still hold a released object whose index has been reused
+            if(m_leaves[goId.sparseIndex] != kNullNode)
+            {
+                SJ_ASSERT(!Contains(goId), "Game object is already in the BVH");
+                Remove(m_nodes[m_leaves[goId.sparseIndex]].goId);
+            }
+
+            const int32_t leaf = AllocateNode();
+            m_nodes[leaf].goId = goId;
+            m_nodes[leaf].objectBounds = bounds;
+            m_nodes[leaf].bounds = Fatten(bounds, m_margin);
+            m_nodes[leaf].height = 0;
+
+            m_leaves[goId.sparseIndex] = leaf;
+            InsertLeaf(leaf);
+            m_size++;
+        }
+
+        /**
+         * Moves a leaf's bounds. The tree is only restructured when the new bounds escape the
+         * fattened box, or have shrunk well inside it
+         * @return True if the leaf was reinserted
+         */
+        bool Update(GameObjectId goId, const AABB& bounds)
+        {
+            SJ_ASSERT(Contains(goId), "Game object is not in the BVH");
+
+            const int32_t leaf = m_leaves[goId.sparseIndex];
+            m_nodes[leaf].objectBounds = bounds;
+
+            const AABB& fatBounds = m_nodes[leaf].bounds;
+            if(fatBounds.Contains(bounds) && Fatten(bounds, m_margin * 4.0f).Contains(fatBounds))
+                return false;
+
+            RemoveLeaf(leaf);
+            m_nodes[leaf].bounds = Fatten(bounds, m_margin);
+            InsertLeaf(leaf);
+
+            return true;
+        }
+
+        void Remove(GameObjectId goId)
+        {
+            SJ_ASSERT(Contains(goId), "Game object is not in the BVH");
+
+            const int32_t leaf = m_leaves[goId.sparseIndex];
+            m_leaves[goId.sparseIndex] = kNullNode;
+
+            RemoveLeaf(leaf);
+            FreeNode(leaf);
+            m_size--;
+        }
+
+        /**
+         * Removes every object pred returns true for
+         */
+        template <class Pred>
+        void RemoveIf(Pred&& pred)
+        {
+            for(int32_t leaf : m_leaves)
+            {
+                if(leaf != kNullNode && pred(m_nodes[leaf].goId))
+                    Remove(m_nodes[leaf].goId);
+            }
+        }
+
+        [[nodiscard]] bool Contains(GameObjectId goId) const
+        {
+            if(goId.sparseIndex >= m_leaves.size() || m_leaves[goId.sparseIndex] == kNullNode)
+                return false;
+
+            return m_nodes[m_leaves[goId.sparseIndex]].goId.generation == goId.generation;
+        }
+
+        void Clear()
+        {
+            m_nodes.clear();
+            m_leaves.clear();
+            m_root = kNullNode;
+            m_freeList = kNullNode;
+            m_size = 0;
+        }
+
+        /** Number of objects in the tree */
+        [[nodiscard]] size_t GetSize() const
+        {
+            return m_size;
+        }
+
+        /** Edges from the root to the deepest leaf. 0 for an empty tree or a single object */
+        [[nodiscard]] int32_t GetHeight() const
+        {
+            return m_root == kNullNode ? 0 : m_nodes[m_root].height;
+        }
+
+        /**
+         * Objects whose bounds overlap bounds
+         */
+        size_t QueryOverlaps(const AABB& bounds, std::span<GameObjectId> out) const
+        {
+            size_t count = 0;
+            Traverse([&](const AABB& nodeBounds) { return nodeBounds.Overlaps(bounds); },
+                     [&](const Node& leaf) {
+                         if(leaf.objectBounds.Overlaps(bounds))
+                             WriteResult(out, count, leaf.goId);
+                     });
+
+            return count;
+        }
+
+        /**
+         * Objects whose bounds intersect frustum. Conservative like Frustum::Intersects
+         */
+        size_t QueryFrustum(const Frustum& frustum, std::span<GameObjectId> out) const
+        {
+            size_t count = 0;
+            Traverse([&](const AABB& nodeBounds) { return frustum.Intersects(nodeBounds); },
+                     [&](const Node& leaf) {
+                         if(frustum.Intersects(leaf.objectBounds))
+                             WriteResult(out, count, leaf.goId);
+                     });
+
+            return count;
+        }
+
+        /**
+         * Every object the ray enters within maxDistance, in no particular order.
+         * A ray starting inside a box hits it at distance 0
+         */
+        size_t Raycast(const Vec3& origin,
+                       const Vec3& direction,
+                       float maxDistance,
+                       std::span<RayHit> out) const
+        {
+            const Ray ray(origin, direction);
+
+            size_t count = 0;
+            Traverse([&](const AABB& nodeBounds) { return ray.Hit(nodeBounds, maxDistance); },
+                     [&](const Node& leaf) {
+                         if(std::optional<float> distance = ray.Hit(leaf.objectBounds, maxDistance))
+                             WriteResult(out, count, RayHit {leaf.goId, *distance});
+                     });
+
+            return count;
+        }
+
+        /**
+         * Nearest object the ray enters within maxDistance. Prunes everything further than the
+         * best hit so far, so prefer this over Raycast for picking and line of sight
+         */
+        [[nodiscard]] std::optional<RayHit>
+        RaycastClosest(const Vec3& origin, const Vec3& direction, float maxDistance) const
+        {
+            const Ray ray(origin, direction);
+
+            std::optional<RayHit> closest;
+            Traverse([&](const AABB& nodeBounds) { return ray.Hit(nodeBounds, maxDistance); },
+                     [&](const Node& leaf) {
+                         if(std::optional<float> distance = ray.Hit(leaf.objectBounds, maxDistance))
+                         {
+                             maxDistance = *distance;
+                             closest = RayHit {leaf.goId, *distance};
+                         }
+                     });
+
+            return closest;
+        }
+
+    private:
+        static constexpr int32_t kNullNode = -1;
+
+        // Rotations keep the tree AVL balanced, so this covers far more objects than fit in memory
+        static constexpr size_t kMaxTraversalDepth = 64;
+
+        struct Node
+        {
+            [[nodiscard]] bool IsLeaf() const
+            {
+                return child1 == kNullNode;
+            }
+
+            /** Fattened for leaves, the union of the children for internal nodes */
+            AABB bounds = {};
+
+            /** Leaves only. The object's actual bounds */
+            AABB objectBounds = {};
+
+            /** Next free node while on the free list */
+            int32_t parent = kNullNode;
+            int32_t child1 = kNullNode;
+            int32_t child2 = kNullNode;
+            int32_t height = 0;
+
+            GameObjectId goId = {};
+        };
+
+        /**
+         * Slab test with the reciprocal direction precomputed
+         */
+        struct Ray
+        {
+            Ray(const Vec3& rayOrigin, const Vec3& rayDirection)
+                : origin {rayOrigin.x, rayOrigin.y, rayOrigin.z},
+                  direction {rayDirection.x, rayDirection.y, rayDirection.z}
+            {
+                for(int axis = 0; axis < 3; axis++)
+                    invDirection[axis] = 1.0f / direction[axis];
+            }
+
+            [[nodiscard]] std::optional<float> Hit(const AABB& box, float maxDistance) const
+            {
+                const std::array<float, 3> boxMin = {box.min.x, box.min.y, box.min.z};
+                const std::array<float, 3> boxMax = {box.max.x, box.max.y, box.max.z};
+
+                float tMin = 0.0f;
+                float tMax = maxDistance;
+                for(int axis = 0; axis < 3; axis++)
+                {
+                    // Parallel to this slab, the reciprocal would produce NaNs on the boundary
+                    if(direction[axis] == 0.0f)
+                    {
+                        if(origin[axis] < boxMin[axis] || origin[axis] > boxMax[axis])
+                            return std::nullopt;
+
+                        continue;
+                    }
+
+                    const float t1 = (boxMin[axis] - origin[axis]) * invDirection[axis];
+                    const float t2 = (boxMax[axis] - origin[axis]) * invDirection[axis];
+                    tMin = std::max(tMin, std::min(t1, t2));
+                    tMax = std::min(tMax, std::max(t1, t2));
+
+                    if(tMin > tMax)
+                        return std::nullopt;
+                }
+
+                return tMin;
+            }
+
+            std::array<float, 3> origin;
+            std::array<float, 3> direction;
+            std::array<float, 3> invDirection;
+        };
+
+        [[nodiscard]] static AABB Fatten(const AABB& bounds, float margin)
+        {
+            return {.min = {bounds.min.x - margin, bounds.min.y - margin, bounds.min.z - margin},
+                    .max = {bounds.max.x + margin, bounds.max.y + margin, bounds.max.z + margin}};
+        }
+
+        template <class T>
+        static void WriteResult(std::span<T> out, size_t& count, const T& result)
+        {
+            if(count < out.size())
+                out[count] = result;
+
+            count++;
+        }
+
+        /**
+         * Depth first walk over nodes whose bounds pass nodeTest, calling visitLeaf for each leaf.
+         * nodeTest is re-evaluated per node, so it may tighten as leaves are visited
+         */
+        template <class NodeTest, class LeafVisitor>
+        void Traverse(NodeTest&& nodeTest, LeafVisitor&& visitLeaf) const
+        {
+            if(m_root == kNullNode)
+                return;
+
+            std::array<int32_t, kMaxTraversalDepth> stack;
+            size_t stackSize = 0;
+            stack[stackSize++] = m_root;
+
+            while(stackSize > 0)
+            {
+                const Node& node = m_nodes[stack[--stackSize]];
+                if(!nodeTest(node.bounds))
+                    continue;
+
+                if(node.IsLeaf())
+                {
+                    visitLeaf(node);
+                    continue;
+                }
+
+                SJ_ASSERT(stackSize + 2 <= stack.size(), "BVH traversal stack overflow");
+                stack[stackSize++] = node.child1;
+                stack[stackSize++] = node.child2;
+            }
+        }
+
+        int32_t AllocateNode()
+        {
+            if(m_freeList == kNullNode)
+            {
+                m_nodes.emplace_back();
+                return static_cast<int32_t>(m_nodes.size() - 1);
+            }
+
+            const int32_t node = m_freeList;
+            m_freeList = m_nodes[node].parent;
+            m_nodes[node] = Node {};
+
+            return node;
+        }
+
+        void FreeNode(int32_t node)
+        {
+            m_nodes[node].parent = m_freeList;
+            m_nodes[node].height = -1;
+            m_freeList = node;
+        }
+
+        void InsertLeaf(int32_t leaf)
+        {
+            if(m_root == kNullNode)
+            {
+                m_root = leaf;
+                m_nodes[leaf].parent = kNullNode;
+                return;
+            }
+
+            // Walk down to the cheapest sibling. Creating a parent at a node costs the merged
+            // area, and every ancestor above it grows by however much the leaf enlarges it
+            const AABB leafBounds = m_nodes[leaf].bounds;
+            int32_t index = m_root;
+            while(!m_nodes[index].IsLeaf())
+            {
+                const Node& node = m_nodes[index];
+
+                const float area = node.bounds.GetSurfaceArea();
+                const float combinedArea = AABB::Merge(node.bounds, leafBounds).GetSurfaceArea();
+
+                const float cost = 2.0f * combinedArea;
+                const float inheritanceCost = 2.0f * (combinedArea - area);
+
+                auto descendCost = [&](int32_t child) {
+                    const AABB& childBounds = m_nodes[child].bounds;
+                    const float mergedArea = AABB::Merge(childBounds, leafBounds).GetSurfaceArea();
+
+                    if(m_nodes[child].IsLeaf())
+                        return mergedArea + inheritanceCost;
+
+                    return mergedArea - childBounds.GetSurfaceArea() + inheritanceCost;
+                };
+
+                const float cost1 = descendCost(node.child1);
+                const float cost2 = descendCost(node.child2);
+
+                if(cost < cost1 && cost < cost2)
+                    break;
+
+                index = cost1 < cost2 ? node.child1 : node.child2;
+            }
+
+            const int32_t sibling = index;
+            const int32_t oldParent = m_nodes[sibling].parent;
+
+            // May grow m_nodes, so no references are held across it
+            const int32_t newParent = AllocateNode();
+            m_nodes[newParent].parent = oldParent;
+            m_nodes[newParent].bounds = AABB::Merge(leafBounds, m_nodes[sibling].bounds);
+            m_nodes[newParent].height = m_nodes[sibling].height + 1;
+            m_nodes[newParent].child1 = sibling;
+            m_nodes[newParent].child2 = leaf;
+            m_nodes[sibling].parent = newParent;
+            m_nodes[leaf].parent = newParent;
+
+            ReplaceChild(oldParent, sibling, newParent);
+            RefitAncestors(m_nodes[leaf].parent);
+        }
+
+        void RemoveLeaf(int32_t leaf)
+        {
+            if(leaf == m_root)
+            {
+                m_root = kNullNode;
+                return;
+            }
+
+            const int32_t parent = m_nodes[leaf].parent;
+            const int32_t grandParent = m_nodes[parent].parent;
+            const int32_t sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2
+                                                                   : m_nodes[parent].child1;
+
+            ReplaceChild(grandParent, parent, sibling);
+            m_nodes[sibling].parent = grandParent;
+            FreeNode(parent);
+
+            RefitAncestors(grandParent);
+        }
+
+        /** Points parent (or the root when parent is null) at newChild instead of oldChild */
+        void ReplaceChild(int32_t parent, int32_t oldChild, int32_t newChild)
+        {
+            if(parent == kNullNode)
+            {
+                m_root = newChild;
+                return;
+            }
+
+            if(m_nodes[parent].child1 == oldChild)
+                m_nodes[parent].child1 = newChild;
+            else
+                m_nodes[parent].child2 = newChild;
+        }
+
+        void RefitAncestors(int32_t index)
+        {
+            while(index != kNullNode)
+            {
+                index = Balance(index);
+
+                Node& node = m_nodes[index];
+                const Node& child1 = m_nodes[node.child1];
+                const Node& child2 = m_nodes[node.child2];
+
+                node.bounds = AABB::Merge(child1.bounds, child2.bounds);
+                node.height = 1 + std::max(child1.height, child2.height);
+
+                index = node.parent;
+            }
+        }
+
+        /**
+         * If a's subtrees differ in height by more than one, rotates the taller child up into a's
+         * place
+         * @return The node now at a's position
+         */
+        int32_t Balance(int32_t a)
+        {
+            Node& nodeA = m_nodes[a];
+            if(nodeA.IsLeaf() || nodeA.height < 2)
+                return a;
+
+            const int32_t balance = m_nodes[nodeA.child2].height - m_nodes[nodeA.child1].height;
+
+            if(balance > 1)
+                return Rotate(a, nodeA.child2, nodeA.child1, &Node::child2);
+
+            if(balance < -1)
+                return Rotate(a, nodeA.child1, nodeA.child2, &Node::child1);
+
+            return a;
+        }
+
+        /**
+         * Rotates a's taller child, up, into a's place. a keeps shortChild and takes up's shorter
+         * child, up keeps its taller one
+         * @param upSlot Which of a's child slots up is in
+         */
+        int32_t Rotate(int32_t a, int32_t up, int32_t shortChild, int32_t Node::* upSlot)
+        {
+            Node& nodeA = m_nodes[a];
+            Node& nodeUp = m_nodes[up];
+
+            const int32_t grandChild1 = nodeUp.child1;
+            const int32_t grandChild2 = nodeUp.child2;
+
+            nodeUp.child1 = a;
+            nodeUp.parent = nodeA.parent;
+            nodeA.parent = up;
+            ReplaceChild(nodeUp.parent, a, up);
+
+            const bool keepFirst = m_nodes[grandChild1].height > m_nodes[grandChild2].height;
+            const int32_t kept = keepFirst ? grandChild1 : grandChild2;
+            const int32_t given = keepFirst ? grandChild2 : grandChild1;
+
+            nodeUp.child2 = kept;
+            nodeA.*upSlot = given;
+            m_nodes[given].parent = a;
+
+            nodeA.bounds = AABB::Merge(m_nodes[shortChild].bounds, m_nodes[given].bounds);
+            nodeA.height = 1 + std::max(m_nodes[shortChild].height, m_nodes[given].height);
+
+            nodeUp.bounds = AABB::Merge(nodeA.bounds, m_nodes[kept].bounds);
+            nodeUp.height = 1 + std::max(nodeA.height, m_nodes[kept].height);
+
+            return up;
+        }
+
+        float m_margin = 0.1f;
+
+        dynamic_vector<Node> m_nodes;
+
+        /** Leaf node of each object, indexed by GameObjectId::sparseIndex like a sparse set */
+        dynamic_vector<int32_t> m_leaves;
+
+        int32_t m_root = kNullNode;
+        int32_t m_freeList = kNullNode;
+        size_t m_size = 0;
+    };
+} // namespace sj
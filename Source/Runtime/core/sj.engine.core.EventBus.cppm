@@ -0,0 +1,180 @@
+module;
+
+// STD Headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <span>
+#include <type_traits>
+
+// Screwjank Headers
+#include <ScrewjankStd/Assert.hpp>
+
+export module sj.engine.core.EventBus;
+import sj.std.containers.vector;
+import sj.std.memory.resources;
+import sj.std.type_info;
+
+export namespace sj
+{
+
+/**
+ * Deferred event queues, one per event type, stored in frame memory.
+ * Events are appended with Enqueue and delivered in batches by Dispatch, which hands each queue to
+ * the drain function registered for its type. Queues are double buffered: events enqueued while
+ * dispatching (e.g. gameplay events raised by an input handler) land in the other buffer and are
+ * delivered on the next Dispatch.
+ * Event order is preserved within a type, not across types. Events must be trivially copyable
+ * since frame memory is released without running destructors. Not thread safe
+ */
+class EventBus
+{
+public:
+    /**
+     * Receives every event of one type queued since the last dispatch
+     * @param context Pointer passed to Dispatch
+     */
+    template <class Event>
+    using DrainFn = void (*)(void* context, std::span<const Event> events);
+
+    static constexpr size_t kMaxEventTypes = 32;
+
+    EventBus() = default;
+    EventBus(const EventBus& other) = delete;
+    EventBus(EventBus&& other) = delete;
+    EventBus& operator=(const EventBus& other) = delete;
+    EventBus& operator=(EventBus&& other) = delete;
+
+    /**
+     * Allocates both frame buffers from parent. Frames that outgrow frameBufferSize chain extra
+     * blocks from parent, which are returned when that frame is dispatched
+     */
+    void Init(std::pmr::memory_resource* parent, size_t frameBufferSize)
+    {
+        mParentResource = parent;
+
+        for(Frame& frame : mFrames)
+        {
+            void* memory = parent->allocate(frameBufferSize);
+            frame.allocator.init(frameBufferSize, reinterpret_cast<std::byte*>(memory));
+            frame.allocator.set_overflow_resource(parent);
+        }
+    }
+
+    void DeInit()
+    {
+        for(Frame& frame : mFrames)
+        {
+            frame.queues.clear();
+            frame.allocator.reset();
+            mParentResource->deallocate(frame.allocator.data(), frame.allocator.buffer_size());
+        }
+
+        mParentResource = nullptr;
+    }
+
+    /**
+     * Appends evt to its type's queue
+     * @tparam tDrainFn Called with the queue once per Dispatch
+     */
+    template <auto tDrainFn, class Event>
+        requires std::is_convertible_v<decltype(tDrainFn), DrainFn<Event>>
+    void Enqueue(const Event& evt)
+    {
+        static_assert(std::is_trivially_copyable_v<Event>,
+                      "Queued events live in frame memory and must be trivially copyable");
+
+        Frame& frame = mFrames[mActiveFrame];
+        Queue& queue = FindOrAddQueue(frame, type_id_of<Event>, &DrainTrampoline<Event, tDrainFn>);
+
+        if(queue.count == queue.capacity)
+        {
+            // Old storage is abandoned, frame memory is reclaimed all at once on dispatch
+            const uint32_t newCapacity = std::max(kMinQueueCapacity, queue.capacity * 2);
+            void* storage = frame.allocator.allocate(newCapacity * sizeof(Event), alignof(Event));
+            if(queue.count > 0)
+                std::memcpy(storage, queue.events, queue.count * sizeof(Event));
+
+            queue.events = storage;
+            queue.capacity = newCapacity;
+        }
+
+        std::memcpy(static_cast<Event*>(queue.events) + queue.count, &evt, sizeof(Event));
+        queue.count++;
+    }
+
+    /**
+     * Drains every queue filled since the last dispatch, then releases their frame memory
+     * @param context Forwarded to each drain function
+     */
+    void Dispatch(void* context)
+    {
+        Frame& frame = mFrames[mActiveFrame];
+        mActiveFrame ^= 1;
+
+        for(const Queue& queue : frame.queues)
+            queue.drain(context, queue.events, queue.count);
+
+        frame.queues.clear();
+        frame.allocator.reset();
+    }
+
+    /** Number of events waiting for the next Dispatch */
+    [[nodiscard]] size_t GetNumQueuedEvents() const
+    {
+        size_t count = 0;
+        for(const Queue& queue : mFrames[mActiveFrame].queues)
+            count += queue.count;
+
+        return count;
+    }
+
+private:
+    using ErasedDrainFn = void (*)(void* context, const void* events, size_t count);
+
+    static constexpr uint32_t kMinQueueCapacity = 16;
+
+    struct Queue
+    {
+        TypeId type = 0;
+        ErasedDrainFn drain = nullptr;
+        void* events = nullptr;
+        uint32_t count = 0;
+        uint32_t capacity = 0;
+    };
+
+    struct Frame
+    {
+        linear_allocator allocator;
+        static_vector<Queue, kMaxEventTypes> queues;
+    };
+
+    template <class Event, auto tDrainFn>
+    static void DrainTrampoline(void* context, const void* events, size_t count)
+    {
+        tDrainFn(context, std::span(static_cast<const Event*>(events), count));
+    }
+
+    static Queue& FindOrAddQueue(Frame& frame, TypeId type, ErasedDrainFn drain)
+    {
+        for(Queue& queue : frame.queues)
+        {
+            if(queue.type == type)
+                return queue;
+        }
+
+        SJ_ASSERT(frame.queues.size() < kMaxEventTypes,
+                  "EventBus supports at most {} event types per frame",
+                  kMaxEventTypes);
+
+        return frame.queues.emplace_back(Queue {.type = type, .drain = drain});
+    }
+
+    std::pmr::memory_resource* mParentResource = nullptr;
+    Frame mFrames[2];
+    uint32_t mActiveFrame = 0;
+};
+
+} // namespace sj
@@ -24,7 +24,7 @@ import sj.engine.core.Window;
 import sj.engine.config.InputConfig;
 
 import sj.std.string_hash;
-import sj.std.containers.map;
+import sj.std.containers.hash_map;
 import sj.std.containers.vector;
 
 export namespace sj
@@ -129,6 +129,6 @@ private:
     bool mProcessMouseInput = false;
 
     const InputBindings* mBindings = nullptr;
-    sj::dynamic_flat_map<string_hash, float> mInputAxes;
+    sj::dynamic_hash_map<string_hash, float> mInputAxes;
 };
 } // namespace sj
@@ -0,0 +1,67 @@
+module;
+
+#include <ScrewjankStd/Assert.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+export module sj.engine.core.OccluderComponent;
+import sj.datadefs.DataChunk;
+import sj.datadefs.assets.Mesh;
+import sj.std.containers.vector;
+import sj.std.math;
+import sj.engine.ecs.ECSRegistry;
+import sj.engine.ecs.Identifiers;
+import sj.engine.ecs.Serialization;
+
+export namespace sj
+{
+/**
+ * Marks a game object as hiding what's behind it. Holds the low poly proxy the mesh builder
+ * generates, in model space relative to the game object's TransformComponent
+ */
+struct OccluderComponent
+{
+    dynamic_vector<Vec3> positions;
+    dynamic_vector<uint16_t> indices;
+};
+
+struct OccluderChunk
+{
+    std::string_view occluder_path;
+};
+
+template <>
+void LoadComponent<OccluderComponent>(ECSRegistry& registry,
+                                      GameObjectId goId,
+                                      const DataChunk& componentData)
+{
+    auto chunk = componentData.Get<OccluderChunk>();
+
+    std::ifstream file(std::string(chunk.occluder_path), std::ios::binary);
+    SJ_ASSERT(file.is_open(), "Failed to open occluder {}", chunk.occluder_path);
+
+    OccluderHeader header = {};
+    file.read(reinterpret_cast<char*>(&header), sizeof(OccluderHeader));
+    SJ_ASSERT(file, "Occluder {} is truncated", chunk.occluder_path);
+    SJ_ASSERT(header.type == AssetType::kOccluder, "Invalid occluder load");
+    SJ_ASSERT(header.version == OccluderHeader::kVersion,
+              "Stale occluder {}, rebuild assets",
+              chunk.occluder_path);
+
+    OccluderComponent occluder;
+    occluder.positions.resize(header.numVerts);
+    occluder.indices.resize(header.numIndices);
+    file.read(reinterpret_cast<char*>(occluder.positions.data()),
+              static_cast<std::streamsize>(sizeof(Vec3) * header.numVerts));
+    SJ_ASSERT(file, "Occluder {} is truncated", chunk.occluder_path);
+    file.read(reinterpret_cast<char*>(occluder.indices.data()),
+              static_cast<std::streamsize>(sizeof(uint16_t) * header.numIndices));
+    SJ_ASSERT(file, "Occluder {} is truncated", chunk.occluder_path);
+
+    registry.CreateComponent<OccluderComponent>(goId, std::move(occluder));
+};
+} // namespace sj
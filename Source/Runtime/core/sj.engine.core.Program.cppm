@@ -10,6 +10,7 @@ module;
 
 #include <concepts>
 #include <memory>
+#include <span>
 #include <string_view>
 #include <tuple>
 
@@ -17,12 +18,16 @@ export module sj.engine.core.Program;
 export import sj.engine.config;
 export import sj.std.type_info;
 export import sj.std.signal;
+export import sj.engine.core.EventBus;
 
+import sj.engine.system.threading.JobSystem;
+import sj.engine.system.threading.Task;
 import sj.engine.system.threading.ThreadContext;
 import sj.engine.system.memory.MemorySystem;
 import sj.engine.system.Timer;
 
 import sj.std.memory.literals;
+import sj.std.containers.bitset;
 import sj.std.containers.map;
 import sj.std.containers.type_list;
 import sj.std.tuple;
@@ -38,7 +43,9 @@ public:
     Program(uint64_t rootHeapSize)
     {
         sj::MemorySystem::Init(rootHeapSize);
-        sj::ThreadContext::Init(sj::MemorySystem::GetRootMemoryResource(), 256_KiB);
+        sj::ThreadContext::Init(sj::MemorySystem::GetRootMemoryResource(), 64_KiB);
+        sj::JobSystem::Init();
+        mEventBus.Init(sj::MemorySystem::GetRootMemoryResource(), 64_KiB);
 
         mConfig = LoadConfig();
 
@@ -57,6 +64,15 @@ public:
         sj::for_each_reverse(mModules, destroyModuleFn);
 
         SDL_Quit();
+
+        mEventBus.DeInit();
+        sj::JobSystem::DeInit();
+        sj::CoroutineFrameAllocator::Release();
+        sj::ThreadContext::DeInit();
+
+#ifndef SJ_GOLD
+        sj::MemorySystem::ReportLeaks();
+#endif
     };
 
     void Start()
@@ -101,6 +117,16 @@ public:
         }(std::index_sequence_for<Modules...> {});
     }
 
+    /**
+     * Defers evt to the start of the next frame, where every event of its type is delivered to
+     * the modules in one batch. Consumption works as with EmitEvent
+     */
+    template <class Event>
+    void QueueEvent(const Event& evt)
+    {
+        mEventBus.template Enqueue<&DrainEvents<Event>>(evt);
+    }
+
 protected:
     void Initialize(this auto&& self)
     {
@@ -135,6 +161,9 @@ protected:
 
             ProcessEvents();
 
+            // Tasks that awaited NextFrame continue on the main thread before modules update
+            TaskScheduler::ResumeNextFrameWaiters();
+
             std::apply(
                 [&](auto&... args) {
                     ((args.NewFrame()), ...);
@@ -163,14 +192,47 @@ protected:
             if(event.type == SDL_EVENT_QUIT)
                 mTerminated = true;
 
-            EmitEvent(event);
+            QueueEvent(event);
         }
+
+        mEventBus.Dispatch(this);
+    }
+
+    /**
+     * Hands a frame's worth of one event type to each module in reverse order.
+     * Each module walks the whole batch, skipping events a later module already consumed
+     */
+    template <class Event>
+    static void DrainEvents(void* context, std::span<const Event> events)
+    {
+        Program& self = *static_cast<Program*>(context);
+
+        scratchpad_scope scratchpad = ThreadContext::GetScratchpad();
+        dynamic_bitset consumed(events.size(), false, &scratchpad.get_allocator());
+
+        [&]<auto... Is>(std::index_sequence<Is...>) {
+            auto drainFn = [&]<class T>(T& m) -> bool {
+                if constexpr(requires { m.ProcessEvent(events[0]); })
+                {
+                    for(size_t i = 0; i < events.size(); i++)
+                    {
+                        if(!consumed.test(i) && m.ProcessEvent(events[i]))
+                            consumed.set(i);
+                    }
+                }
+
+                return !consumed.all();
+            };
+
+            (drainFn(std::get<kNumModules - Is - 1>(self.mModules)) && ...);
+        }(std::index_sequence_for<Modules...> {});
     }
 
     static constexpr float kMaxDeltaTime = 1.0f / 15.0f;
     static constexpr size_t kNumModules = std::tuple_size_v<std::tuple<Modules...>>;
 
     Config mConfig;
+    EventBus mEventBus;
 
     union
     {
@@ -1,14 +1,20 @@
 module;
 
 #include <ScrewjankStd/Assert.hpp>
+#include <ScrewjankEngine/MemoryTag.hpp>
 
 #include <glaze/glaze.hpp>
 
-#include <vector>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
 #include <string_view>
+#include <vector>
 
 export module sj.engine.core.Scene;
 import sj.engine.system.threading.ThreadContext;
+import sj.engine.system.threading.Task;
+import sj.engine.system.memory.MemorySystem;
 import sj.engine.ecs;
 import sj.std;
 import sj.datadefs;
@@ -20,6 +26,58 @@ class Scene
 {
 public:
     Scene(std::string_view path, ECSRegistry& registry, auto ComponentManifest)
+    {
+        SJ_MEM_TAG("Scene");
+
+        auto scope = ThreadContext::GetScratchpad();
+        std::pmr::vector<char> buffer(&scope.get_allocator());
+        SceneChunk chunk;
+
+        glz::error_ctx errorCtx = glz::read_file_json<kReadOpts>(chunk, path, buffer);
+        SJ_ASSERT(errorCtx.ec == glz::error_code::none,
+                  "Failed to load scene {0}. Error {1}",
+                  path,
+                  glz::format_error(errorCtx, buffer));
+
+        Instantiate(chunk, registry, ComponentManifest);
+    }
+
+    /**
+     * Loads a scene without blocking the calling thread.
+     * The file is read and parsed on worker threads, then game objects are created on the main
+     * thread at the start of a following frame.
+     */
+    static task<void> LoadAsync(std::string path, ECSRegistry& registry, auto ComponentManifest)
+    {
+        std::pmr::vector<std::byte> buffer = co_await ReadFileAsync(path);
+        SJ_ASSERT(!buffer.empty(), "Failed to read scene {}", path);
+
+        // glaze expects a null terminated buffer
+        buffer.push_back(std::byte {0});
+        const std::string_view json(reinterpret_cast<const char*>(buffer.data()),
+                                    buffer.size() - 1);
+
+        // Chunk strings view into buffer, which lives in this frame until the scene is built
+        SceneChunk chunk;
+        glz::error_ctx errorCtx = glz::read<kReadOpts>(chunk, json);
+        SJ_ASSERT(errorCtx.ec == glz::error_code::none,
+                  "Failed to load scene {0}. Error {1}",
+                  path,
+                  glz::format_error(errorCtx, json));
+
+        // The registry is owned by the main thread
+        co_await NextFrame {};
+
+        SJ_MEM_TAG("Scene");
+        Instantiate(chunk, registry, ComponentManifest);
+    }
+
+    ~Scene() = default;
+
+private:
+    static constexpr glz::opts kReadOpts = {.error_on_unknown_keys = false};
+
+    static void Instantiate(const SceneChunk& chunk, ECSRegistry& registry, auto ComponentManifest)
     {
         // Map chunk type to function that creates runtime component
         constinit static type_map<ComponentManifest.GetComponentTypes(),
@@ -33,17 +91,6 @@ public:
                                   }>
             kComponentLoadFns = {};
 
-        auto scope = ThreadContext::GetScratchpad();
-        std::pmr::vector<char> buffer(&scope.get_allocator());
-        SceneChunk chunk;
-
-        glz::error_ctx errorCtx =
-            glz::read_file_json<glz::opts {.error_on_unknown_keys = false}>(chunk, path, buffer);
-        SJ_ASSERT(errorCtx.ec == glz::error_code::none,
-                  "Failed to load scene {0}. Error {1}",
-                  path,
-                  glz::format_error(errorCtx, buffer));
-
         for(const GameObjectChunk& goChunk : chunk.game_objects)
         {
             GameObjectId goId = registry.CreateGameObject();
@@ -54,7 +101,5 @@ public:
             }
         }
     }
-
-    ~Scene() = default;
 };
 } // namespace sj
\ No newline at end of file
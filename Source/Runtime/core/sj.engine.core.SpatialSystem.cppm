@@ -0,0 +1,68 @@
+module;
+
+#include <cstdint>
+
+export module sj.engine.core.SpatialSystem;
+import sj.engine.core.BoundsComponent;
+import sj.engine.core.DynamicBVH;
+import sj.engine.core.TransformComponent;
+
+import sj.std.containers.vector;
+import sj.std.math;
+import sj.engine.ecs.ECSRegistry;
+import sj.engine.ecs.Identifiers;
+
+export namespace sj
+{
+    /**
+     * Keeps a DynamicBVH in sync with the world bounds of every game object that has a
+     * BoundsComponent and a TransformComponent
+     */
+    class SpatialSystem
+    {
+    public:
+        void Process(ECSRegistry& registry)
+        {
+            m_frameIndex++;
+
+            for(const auto& [goId, boundsComponent] : registry.GetComponents<BoundsComponent>())
+            {
+                const TransformComponent* transform =
+                    registry.GetComponent<TransformComponent>(goId);
+                if(transform == nullptr)
+                    continue;
+
+                const AABB worldBounds = TransformAABB(boundsComponent.localBounds,
+                                                       transform->localToParentTransform.ToMat44());
+
+                // Objects that haven't moved past their fattened box leave the tree untouched
+                if(m_bvh.Contains(goId))
+                    m_bvh.Update(goId, worldBounds);
+                else
+                    m_bvh.Insert(goId, worldBounds);
+
+                if(goId.sparseIndex >= m_lastSeenFrame.size())
+                    m_lastSeenFrame.resize(goId.sparseIndex + 1, 0);
+
+                m_lastSeenFrame[goId.sparseIndex] = m_frameIndex;
+            }
+
+            // Drop objects that were released or lost their bounds or transform
+            m_bvh.RemoveIf([this](GameObjectId goId) {
+                return m_lastSeenFrame[goId.sparseIndex] != m_frameIndex;
+            });
+        }
+
+        [[nodiscard]] const DynamicBVH& GetBVH() const
+        {
+            return m_bvh;
+        }
+
+    private:
+        DynamicBVH m_bvh;
+
+        /** Indexed by GameObjectId::sparseIndex */
+        dynamic_vector<uint64_t> m_lastSeenFrame;
+        uint64_t m_frameIndex = 0;
+    };
+} // namespace sj
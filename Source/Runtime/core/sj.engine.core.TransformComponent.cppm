@@ -15,12 +15,12 @@ export namespace sj
 struct TransformComponent
 {
     TransformComponent* parent = nullptr;
-    Mat44 localToParentTransform = Mat44(kIdentityTag);
+    Transform localToParentTransform;
 };
 
 struct TransformChunk
 {
-    Mat44 localToParent;
+    Transform localToParent;
 };
 
 template <>
@@ -1,12 +1,18 @@
 module;
 
 export module sj.engine.core;
+export import sj.engine.core.BoundsComponent;
 export import sj.engine.core.CameraComponent;
 export import sj.engine.core.CameraSystem;
+export import sj.engine.core.CullingSystem;
+export import sj.engine.core.DynamicBVH;
+export import sj.engine.core.EventBus;
 export import sj.engine.core.Program;
 export import sj.engine.core.InputSystem;
 export import sj.engine.core.Mesh3DComponent;
+export import sj.engine.core.OccluderComponent;
 export import sj.engine.core.Scene;
+export import sj.engine.core.SpatialSystem;
 export import sj.engine.core.TransformComponent;
 export import sj.engine.core.Window;
 
@@ -8,7 +8,7 @@ export module sj.engine.ecs.ECSRegistry;
 
 import sj.std.containers.any;
 import sj.std.containers.sparse_set;
-import sj.std.containers.map;
+import sj.std.containers.hash_map;
 import sj.std.type_info;
 
 import sj.engine.ecs.ComponentManifest;
@@ -103,6 +103,6 @@ export namespace sj
 
         std::pmr::memory_resource* m_memoryResource = nullptr;
         sparse_set<GameObjectId> m_gameObjects;
-        dynamic_flat_map<TypeId, ComponentPoolHandle> m_componentPools;
+        dynamic_hash_map<TypeId, ComponentPoolHandle> m_componentPools;
     };
 } // namespace sj
@@ -0,0 +1,15 @@
+#pragma once
+
+#define SJ_MEM_TAG_CONCAT_IMPL(a, b) a##b
+#define SJ_MEM_TAG_CONCAT(a, b) SJ_MEM_TAG_CONCAT_IMPL(a, b)
+
+/**
+ * Attributes allocations made in the enclosing scope to tag in allocation reports.
+ * Requires sj.engine.system.memory.MemorySystem to be imported
+ */
+#ifndef SJ_GOLD
+    #define SJ_MEM_TAG(tag)                                                                        \
+        sj::MemoryTagScope SJ_MEM_TAG_CONCAT(sjMemTagScope_, __LINE__)(tag)
+#else
+    #define SJ_MEM_TAG(tag)
+#endif
@@ -4,6 +4,7 @@ module;
 #include <ScrewjankStd/PlatformDetection.hpp>
 #include <ScrewjankStd/Log.hpp>
 #include <ScrewjankStd/Assert.hpp>
+#include <ScrewjankEngine/MemoryTag.hpp>
 
 // Library Headers
 #include <SDL3/SDL_gpu.h>
@@ -12,15 +13,25 @@ module;
 #include <imgui_impl_sdlgpu3.h>
 
 // STD Headers
+#include <array>
 #include <cstddef>
+#include <cstring>
 #include <concepts>
 #include <fstream>
 #include <functional>
 #include <filesystem>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
 #include <type_traits>
+#include <utility>
 
 export module sj.engine.rendering.Renderer;
 import sj.engine.rendering.Events;
+import sj.engine.rendering.FramePacket;
 import sj.engine.rendering.BufferResource;
 import sj.engine.rendering.SamplerResource;
 import sj.engine.rendering.TextureResource;
@@ -29,7 +40,9 @@ import sj.engine.core.Program;
 import sj.engine.core.Window;
 
 import sj.engine.system.threading.ThreadContext;
+import sj.engine.system.threading.Task;
 import sj.engine.system.memory.MemorySystem;
+import sj.std.memory.literals;
 
 import sj.datadefs.assets.Texture;
 import sj.datadefs.assets.Mesh;
@@ -52,6 +65,8 @@ public:
 
     void Initialize(auto& program)
     {
+        SJ_MEM_TAG("Renderer");
+
         mPresentCallbackFn = [&program](const PresentEvent& evt) -> void {
             program.template EmitEvent<const PresentEvent&>(evt);
         };
@@ -71,15 +86,28 @@ public:
 
         mDummyMeshBuffer = UploadMesh("Data/Engine/viking_room.sj_mesh");
         mDummySampler = UploadSamplerTexture("Data/Engine/viking_room.sj_tex");
+
+        if(program.GetConfig().pipelined_rendering)
+        {
+            mPipelined = true;
+            mRenderThread = std::thread(&Renderer::RenderThreadMain, this);
+        }
     }
 
     ~Renderer()
     {
+        if(mRenderThread.joinable())
+        {
+            mFramePackets.Shutdown();
+            mRenderThread.join();
+        }
+
         SDL_ReleaseGPUGraphicsPipeline(mDevice, mDefaultGraphicsPipeline);
         mDummySampler.Release();
         mDummyMeshBuffer.buffer.Release();
         mDepthTarget.Release();
-        mDrawTarget.Release();
+        for(TextureResource& drawTarget : mDrawTargets)
+            drawTarget.Release();
         SDL_ReleaseWindowFromGPUDevice(mDevice, mDisplay->GetWindowHandle());
         SDL_DestroyGPUDevice(mDevice);
     }
@@ -115,6 +143,19 @@ public:
 
     void NewFrame()
     {
+        // Frames finished by the render thread are presented from the main thread
+        if(mPipelined)
+        {
+            std::optional<PresentEvent> completed;
+            {
+                std::scoped_lock lock(mCompletedPresentLock);
+                completed = std::exchange(mCompletedPresent, std::nullopt);
+            }
+
+            if(completed)
+                mPresentCallbackFn(*completed);
+        }
+
         if(!mImGuiEnabled)
             return;
 
@@ -150,64 +191,45 @@ public:
         ImGui_ImplSDLGPU3_Shutdown();
     }
 
-    void Render(const Mat44& cameraMatrix)
+    /**
+     * Queues a mesh to be drawn this frame
+     */
+    void SubmitDraw(const MeshBuffer& mesh, const SamplerResource& sampler, const Mat44& model)
     {
-        SDL_GPUCommandBuffer* commandBuffer = SDL_AcquireGPUCommandBuffer(mDevice);
+        mFramePackets.GetWritePacket().drawList.emplace_back(
+            DrawItem {.modelMatrix = model,
+                      .vertexBinding = mesh.GetVertexBinding(),
+                      .indexBinding = mesh.GetIndexBinding(),
+                      .samplerBinding = {.texture = sampler.GetTexture(),
+                                         .sampler = sampler.GetSampler()},
+                      .numIndices = mesh.numIndices});
+    }
 
-        uint32_t displayWidth = static_cast<uint32_t>(mDisplay->GetViewportSize().GetX());
-        uint32_t displayHeight = static_cast<uint32_t>(mDisplay->GetViewportSize().GetY());
+    /**
+     * Finishes recording this frame's packet.
+     * In pipelined mode the packet is handed to the render thread and the resulting image is
+     * presented at the start of a following frame. Otherwise it is rendered and presented inline.
+     */
+    void Render(const Transform& cameraTransform)
+    {
+        RenderWithView(cameraTransform.Inverse().ToMat44());
+    }
 
-        if(displayWidth != mDepthTarget.GetWidth() || displayHeight != mDepthTarget.GetHeight())
-        {
-            mDepthTarget.Resize(displayWidth, displayHeight);
-            mDrawTarget.Resize(displayWidth, displayHeight);
-        }
+    /** Prefer the Transform overload, which inverts without a matrix inverse */
+    void Render(const Mat44& cameraMatrix)
+    {
+        RenderWithView(cameraMatrix.AffineInverse());
+    }
 
+    /**
+     * The projection draws are submitted with. Combine with the camera's view matrix to get the
+     * frustum to cull against
+     */
+    [[nodiscard]] Mat44 GetProjectionMatrix() const
+    {
         const float aspectRatio =
-            static_cast<float>(displayWidth) / static_cast<float>(displayHeight);
-
-        GlobalUniformBufferObject tmpGUBO {
-            .model = Mat44(kIdentityTag),
-            .view = cameraMatrix.AffineInverse(),
-            .projection = PerspectiveProjection(ToRadians(45.0f), aspectRatio, 10000.0f, 0.1f)};
-
-        SDL_PushGPUVertexUniformData(commandBuffer, 0, &tmpGUBO, sizeof(GlobalUniformBufferObject));
-
-        SDL_GPUColorTargetInfo colorTargetInfo {
-            .texture = mDrawTarget.Get(),
-            .clear_color = {.r = 50 / 255.0f,
-                            .g = 50 / 255.0f,
-                            .b = 240 / 255.0f,
-                            .a = 255 / 255.0f},
-            .load_op = SDL_GPU_LOADOP_CLEAR,
-            .store_op = SDL_GPU_STOREOP_STORE,
-        };
-        SDL_GPUDepthStencilTargetInfo depthTargetInfo {
-            .texture = mDepthTarget.Get(),
-            .clear_depth = 0.0f,
-            .load_op = SDL_GPULoadOp::SDL_GPU_LOADOP_CLEAR,
-            .store_op = SDL_GPUStoreOp::SDL_GPU_STOREOP_DONT_CARE};
-        SDL_GPURenderPass* renderPass =
-            SDL_BeginGPURenderPass(commandBuffer, &colorTargetInfo, 1, &depthTargetInfo);
-
-        SDL_BindGPUGraphicsPipeline(renderPass, mDefaultGraphicsPipeline);
-
-        SDL_GPUBufferBinding vertexBinding = mDummyMeshBuffer.GetVertexBinding();
-        SDL_GPUBufferBinding indexBinding = mDummyMeshBuffer.GetIndexBinding();
-        SDL_GPUTextureSamplerBinding samplerBinding {.texture = mDummySampler.GetTexture(),
-                                                     .sampler = mDummySampler.GetSampler()};
-
-        SDL_BindGPUVertexBuffers(renderPass, 0, &vertexBinding, 1);
-        SDL_BindGPUIndexBuffer(renderPass, &indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
-        SDL_BindGPUFragmentSamplers(renderPass, 0, &samplerBinding, 1);
-        SDL_DrawGPUIndexedPrimitives(renderPass, mDummyMeshBuffer.numIndices, 1, 0, 0, 0);
-        SDL_EndGPURenderPass(renderPass);
-
-        SDL_SubmitGPUCommandBuffer(commandBuffer);
-
-        mPresentCallbackFn(PresentEvent {.image = mDrawTarget.Get(),
-                                         .width = mDrawTarget.GetWidth(),
-                                         .height = mDrawTarget.GetHeight()});
+            mDisplay->GetViewportSize().GetX() / mDisplay->GetViewportSize().GetY();
+        return PerspectiveProjection(ToRadians(kVerticalFov), aspectRatio, kFarPlane, kNearPlane);
     }
 
     void RenderImGui(ImDrawData* drawData)
@@ -291,51 +313,39 @@ public:
         MeshHeader header = {};
         file.read(reinterpret_cast<char*>(&header), sizeof(MeshHeader));
         SJ_ASSERT(header.type == AssetType::kMesh, "Invalid texture load");
+        SJ_ASSERT(header.version == MeshHeader::kVersion, "Stale mesh {}, rebuild assets", path);
 
-        const uint32_t vertexBufferSize = (sizeof(MeshVertex) * header.numVerts);
-        const uint32_t indexBufferSize = (header.indexSize * header.numIndices);
-        const uint32_t vertexAndIndexBufferSizeBytes = vertexBufferSize + indexBufferSize;
-
-        SDL_GPUBufferCreateInfo info {.usage =
-                                          SDL_GPU_BUFFERUSAGE_VERTEX | SDL_GPU_BUFFERUSAGE_INDEX,
-                                      .size = vertexAndIndexBufferSizeBytes};
-
-        BufferResource meshBuffer(mDevice, info);
-
-        SDL_GPUTransferBuffer* transferBuffer =
-            UploadToGPU(vertexAndIndexBufferSizeBytes, [&](std::span<std::byte> uploadBuffer) {
-                char* vertexBufferStart = reinterpret_cast<char*>(uploadBuffer.data());
-                char* indexBufferStart = vertexBufferStart + vertexBufferSize;
+        return CreateMeshBuffer(header, [&](std::span<std::byte> uploadBuffer) {
+            file.read(reinterpret_cast<char*>(uploadBuffer.data()),
+                      static_cast<std::streamsize>(uploadBuffer.size()));
+        });
+    }
 
-                file.read(vertexBufferStart, vertexBufferSize);
-                file.read(indexBufferStart, indexBufferSize);
-            });
+    /**
+     * Reads the mesh on a worker thread, then creates and fills the GPU buffer on the main thread
+     * at the start of a following frame
+     */
+    [[nodiscard]]
+    task<MeshBuffer> UploadMeshAsync(std::string path)
+    {
+        std::pmr::vector<std::byte> fileData = co_await ReadFileAsync(std::move(path));
+        SJ_ASSERT(fileData.size() >= sizeof(MeshHeader), "Invalid mesh load");
 
-        ImmediateCommand([&](SDL_GPUCommandBuffer* cmd) {
-            CopyPass(cmd, [&](SDL_GPUCopyPass* copyPass) {
-                SDL_GPUTransferBufferLocation vertexBufferSrc {.transfer_buffer = transferBuffer,
-                                                               .offset = 0};
-                SDL_GPUTransferBufferLocation indexBufferSrc {.transfer_buffer = transferBuffer,
-                                                              .offset = vertexBufferSize};
+        MeshHeader header = {};
+        std::memcpy(&header, fileData.data(), sizeof(MeshHeader));
+        SJ_ASSERT(header.type == AssetType::kMesh, "Invalid mesh load");
+        SJ_ASSERT(header.version == MeshHeader::kVersion, "Stale mesh file, rebuild assets");
 
-                SDL_GPUBufferRegion vertexBufferDest {.buffer = meshBuffer.GetBuffer(),
-                                                      .offset = 0,
-                                                      .size = vertexBufferSize};
+        // GPU resources are only touched from the main thread
+        co_await NextFrame {};
 
-                SDL_GPUBufferRegion indexBufferDest {.buffer = meshBuffer.GetBuffer(),
-                                                     .offset = vertexBufferSize,
-                                                     .size = indexBufferSize};
+        const std::span<const std::byte> payload =
+            std::span(fileData).subspan(sizeof(MeshHeader));
 
-                SDL_UploadToGPUBuffer(copyPass, &vertexBufferSrc, &vertexBufferDest, false);
-                SDL_UploadToGPUBuffer(copyPass, &indexBufferSrc, &indexBufferDest, false);
-            });
+        co_return CreateMeshBuffer(header, [&](std::span<std::byte> uploadBuffer) {
+            SJ_ASSERT(payload.size() >= uploadBuffer.size(), "Mesh file is truncated");
+            std::memcpy(uploadBuffer.data(), payload.data(), uploadBuffer.size());
         });
-
-        SDL_ReleaseGPUTransferBuffer(mDevice, transferBuffer);
-
-        return MeshBuffer {.buffer = std::move(meshBuffer),
-                           .numIndices = header.numIndices,
-                           .indexBufferOffset = vertexBufferSize};
     }
 
     [[nodiscard]]
@@ -394,6 +404,170 @@ public:
     };
 
 private:
+    /**
+     * Fills in the rest of this frame's packet, then hands it off or renders it inline
+     */
+    void RenderWithView(const Mat44& viewMatrix)
+    {
+        if(mFramePackets.GetWritePacket().drawList.empty())
+            SubmitDraw(mDummyMeshBuffer, mDummySampler, Mat44(kIdentityTag));
+
+        FramePacket& packet = mFramePackets.GetWritePacket();
+        packet.frameIndex = mFrameIndex++;
+        packet.viewMatrix = viewMatrix;
+        packet.viewportWidth = static_cast<uint32_t>(mDisplay->GetViewportSize().GetX());
+        packet.viewportHeight = static_cast<uint32_t>(mDisplay->GetViewportSize().GetY());
+
+        if(mPipelined)
+        {
+            mFramePackets.Publish();
+            return;
+        }
+
+        const PresentEvent presentEvent = RenderPacket(packet);
+        packet.Reset();
+
+        mPresentCallbackFn(presentEvent);
+    }
+
+    /**
+     * Records and submits the draw commands for packet. Only touches renderer state owned by the
+     * thread doing the rendering, so it can run on the render thread
+     */
+    PresentEvent RenderPacket(const FramePacket& packet)
+    {
+        // Alternate draw targets so the main thread can present one while the next is drawn
+        TextureResource& drawTarget = mDrawTargets[mPipelined ? packet.frameIndex & 1 : 0];
+
+        SDL_GPUCommandBuffer* commandBuffer = SDL_AcquireGPUCommandBuffer(mDevice);
+
+        const uint32_t displayWidth = packet.viewportWidth;
+        const uint32_t displayHeight = packet.viewportHeight;
+
+        if(displayWidth != mDepthTarget.GetWidth() || displayHeight != mDepthTarget.GetHeight())
+            mDepthTarget.Resize(displayWidth, displayHeight);
+
+        if(displayWidth != drawTarget.GetWidth() || displayHeight != drawTarget.GetHeight())
+            drawTarget.Resize(displayWidth, displayHeight);
+
+        const float aspectRatio =
+            static_cast<float>(displayWidth) / static_cast<float>(displayHeight);
+
+        GlobalUniformBufferObject tmpGUBO {
+            .model = Mat44(kIdentityTag),
+            .view = packet.viewMatrix,
+            .projection =
+                PerspectiveProjection(ToRadians(kVerticalFov), aspectRatio, kFarPlane, kNearPlane)};
+
+        SDL_GPUColorTargetInfo colorTargetInfo {
+            .texture = drawTarget.Get(),
+            .clear_color = {.r = 50 / 255.0f,
+                            .g = 50 / 255.0f,
+                            .b = 240 / 255.0f,
+                            .a = 255 / 255.0f},
+            .load_op = SDL_GPU_LOADOP_CLEAR,
+            .store_op = SDL_GPU_STOREOP_STORE,
+        };
+        SDL_GPUDepthStencilTargetInfo depthTargetInfo {
+            .texture = mDepthTarget.Get(),
+            .clear_depth = 0.0f,
+            .load_op = SDL_GPULoadOp::SDL_GPU_LOADOP_CLEAR,
+            .store_op = SDL_GPUStoreOp::SDL_GPU_STOREOP_DONT_CARE};
+        SDL_GPURenderPass* renderPass =
+            SDL_BeginGPURenderPass(commandBuffer, &colorTargetInfo, 1, &depthTargetInfo);
+
+        SDL_BindGPUGraphicsPipeline(renderPass, mDefaultGraphicsPipeline);
+
+        for(const DrawItem& item : packet.drawList)
+        {
+            tmpGUBO.model = item.modelMatrix;
+            SDL_PushGPUVertexUniformData(commandBuffer,
+                                         0,
+                                         &tmpGUBO,
+                                         sizeof(GlobalUniformBufferObject));
+
+            SDL_BindGPUVertexBuffers(renderPass, 0, &item.vertexBinding, 1);
+            SDL_BindGPUIndexBuffer(renderPass, &item.indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+            SDL_BindGPUFragmentSamplers(renderPass, 0, &item.samplerBinding, 1);
+            SDL_DrawGPUIndexedPrimitives(renderPass, item.numIndices, 1, 0, 0, 0);
+        }
+
+        SDL_EndGPURenderPass(renderPass);
+
+        SDL_SubmitGPUCommandBuffer(commandBuffer);
+
+        return PresentEvent {.image = drawTarget.Get(),
+                             .width = drawTarget.GetWidth(),
+                             .height = drawTarget.GetHeight()};
+    }
+
+    void RenderThreadMain()
+    {
+        ThreadContext::Init(MemorySystem::GetUnmanagedMemoryResource(), 64_KiB);
+
+        while(const FramePacket* packet = mFramePackets.AcquireReadPacket())
+        {
+            const PresentEvent presentEvent = RenderPacket(*packet);
+
+            {
+                std::scoped_lock lock(mCompletedPresentLock);
+                mCompletedPresent = presentEvent;
+            }
+
+            mFramePackets.ReleaseReadPacket();
+        }
+
+        ThreadContext::DeInit();
+    }
+
+    /**
+     * Creates a vertex + index buffer for the mesh described by header
+     * @param fillFn Writes the vertex data followed by the index data into the upload buffer
+     */
+    template <class Fn>
+        requires std::invocable<Fn, std::span<std::byte>>
+    MeshBuffer CreateMeshBuffer(const MeshHeader& header, Fn&& fillFn)
+    {
+        const uint32_t vertexBufferSize = (sizeof(MeshVertex) * header.numVerts);
+        const uint32_t indexBufferSize = (header.indexSize * header.numIndices);
+        const uint32_t vertexAndIndexBufferSizeBytes = vertexBufferSize + indexBufferSize;
+
+        SDL_GPUBufferCreateInfo info {.usage =
+                                          SDL_GPU_BUFFERUSAGE_VERTEX | SDL_GPU_BUFFERUSAGE_INDEX,
+                                      .size = vertexAndIndexBufferSizeBytes};
+
+        BufferResource meshBuffer(mDevice, info);
+
+        SDL_GPUTransferBuffer* transferBuffer =
+            UploadToGPU(vertexAndIndexBufferSizeBytes, std::forward<Fn>(fillFn));
+
+        ImmediateCommand([&](SDL_GPUCommandBuffer* cmd) {
+            CopyPass(cmd, [&](SDL_GPUCopyPass* copyPass) {
+                SDL_GPUTransferBufferLocation vertexBufferSrc {.transfer_buffer = transferBuffer,
+                                                               .offset = 0};
+                SDL_GPUTransferBufferLocation indexBufferSrc {.transfer_buffer = transferBuffer,
+                                                              .offset = vertexBufferSize};
+
+                SDL_GPUBufferRegion vertexBufferDest {.buffer = meshBuffer.GetBuffer(),
+                                                      .offset = 0,
+                                                      .size = vertexBufferSize};
+
+                SDL_GPUBufferRegion indexBufferDest {.buffer = meshBuffer.GetBuffer(),
+                                                     .offset = vertexBufferSize,
+                                                     .size = indexBufferSize};
+
+                SDL_UploadToGPUBuffer(copyPass, &vertexBufferSrc, &vertexBufferDest, false);
+                SDL_UploadToGPUBuffer(copyPass, &indexBufferSrc, &indexBufferDest, false);
+            });
+        });
+
+        SDL_ReleaseGPUTransferBuffer(mDevice, transferBuffer);
+
+        return MeshBuffer {.buffer = std::move(meshBuffer),
+                           .numIndices = header.numIndices,
+                           .indexBufferOffset = vertexBufferSize};
+    }
+
     void InitRenderTargets()
     {
         SDL_GPUTextureCreateInfo targetInfo {
@@ -405,7 +579,8 @@ private:
 
         targetInfo.format = SDL_GPUTextureFormat::SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM;
         targetInfo.usage = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_SAMPLER;
-        mDrawTarget = TextureResource(mDevice, targetInfo);
+        for(TextureResource& drawTarget : mDrawTargets)
+            drawTarget = TextureResource(mDevice, targetInfo);
 
         targetInfo.format = SDL_GPUTextureFormat::SDL_GPU_TEXTUREFORMAT_D16_UNORM;
         targetInfo.usage = SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET;
@@ -452,7 +627,7 @@ private:
         };
 
         std::array<SDL_GPUColorTargetDescription, 1> colorTargets {
-            SDL_GPUColorTargetDescription {.format = mDrawTarget.GetFormat()}};
+            SDL_GPUColorTargetDescription {.format = mDrawTargets[0].GetFormat()}};
 
         SDL_GPUGraphicsPipelineCreateInfo info {
             .vertex_shader = vertexShader,
@@ -501,7 +676,7 @@ private:
      * https://www.youtube.com/watch?v=U0_ONQQ5ZNM
      * https://www.youtube.com/watch?v=YO46x8fALzE
      */
-    Mat44 PerspectiveProjection(float verticalFOV, float aspectRatio, float near, float far)
+    static Mat44 PerspectiveProjection(float verticalFOV, float aspectRatio, float near, float far)
     {
         const float invTanHalfvFov = 1.0f / std::tan(verticalFOV / 2.0f);
 
@@ -515,22 +690,36 @@ private:
         return res;
     }
 
-    std::function<void(const PresentEvent&)> mPresentCallbackFn;
+    // FOV is in degrees. Near and far are passed to PerspectiveProjection swapped for reversed Z
+    static constexpr float kVerticalFov = 45.0f;
+    static constexpr float kNearPlane = 0.1f;
+    static constexpr float kFarPlane = 10000.0f;
+
+    inplace_function<void(const PresentEvent&)> mPresentCallbackFn;
 
     Window* mDisplay = nullptr;
 
     bool mImGuiEnabled = false;
 
     SDL_GPUDevice* mDevice = nullptr;
-    TextureResource mDrawTarget {};
+    std::array<TextureResource, 2> mDrawTargets {};
     TextureResource mDepthTarget {};
 
-    sj::dynamic_flat_map<string_hash, MeshBuffer> mMeshes;
-    sj::dynamic_flat_map<string_hash, SamplerResource> mSamplers;
+    sj::dynamic_hash_map<string_hash, MeshBuffer> mMeshes;
+    sj::dynamic_hash_map<string_hash, SamplerResource> mSamplers;
 
     MeshBuffer mDummyMeshBuffer = {};
     SamplerResource mDummySampler;
 
     SDL_GPUGraphicsPipeline* mDefaultGraphicsPipeline = nullptr;
+
+    FramePacketBuffer mFramePackets;
+    uint64_t mFrameIndex = 0;
+
+    // Pipelined mode: the render thread consumes packets and hands finished images back
+    bool mPipelined = false;
+    std::thread mRenderThread;
+    std::mutex mCompletedPresentLock;
+    std::optional<PresentEvent> mCompletedPresent;
 };
 } // namespace sj
\ No newline at end of file
@@ -0,0 +1,135 @@
+module;
+
+#include <SDL3/SDL_gpu.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <semaphore>
+
+export module sj.engine.rendering.FramePacket;
+import sj.std.containers.vector;
+import sj.std.math;
+
+export namespace sj
+{
+/**
+ * Everything needed to issue one draw, resolved on the simulation thread so the render thread
+ * never reads renderer-owned containers
+ */
+struct DrawItem
+{
+    Mat44 modelMatrix;
+    SDL_GPUBufferBinding vertexBinding {};
+    SDL_GPUBufferBinding indexBinding {};
+    SDL_GPUTextureSamplerBinding samplerBinding {};
+    uint32_t numIndices = 0;
+};
+
+/**
+ * Immutable snapshot of the simulation state the renderer needs to draw one frame
+ */
+struct FramePacket
+{
+    uint64_t frameIndex = 0;
+    Mat44 viewMatrix;
+    uint32_t viewportWidth = 0;
+    uint32_t viewportHeight = 0;
+    dynamic_vector<DrawItem> drawList;
+
+    void Reset()
+    {
+        frameIndex = 0;
+        viewMatrix = Mat44(kIdentityTag);
+        viewportWidth = 0;
+        viewportHeight = 0;
+        drawList.clear();
+    }
+};
+
+/**
+ * Double buffered hand-off of frame packets between the simulation and render threads.
+ * Simulation fills one packet while the render thread consumes the other, so the render thread
+ * is never more than one frame behind
+ */
+class FramePacketBuffer
+{
+public:
+    /**
+     * Simulation thread. The packet being recorded this frame
+     */
+    FramePacket& GetWritePacket()
+    {
+        return m_packets[m_writeIndex];
+    }
+
+    /**
+     * Simulation thread. Hands the write packet to the render thread once it has finished with
+     * the previous one, then starts recording into the other packet
+     */
+    void Publish()
+    {
+        m_renderIdle.acquire();
+
+        m_readIndex = m_writeIndex;
+        m_writeIndex ^= 1;
+        m_packets[m_writeIndex].Reset();
+
+        m_packetReady.release();
+    }
+
+    /**
+     * Render thread. Blocks until a packet is published
+     * @return The packet to render, or nullptr if the buffer is shutting down
+     */
+    const FramePacket* AcquireReadPacket()
+    {
+        m_packetReady.acquire();
+
+        if(m_shutdown.load(std::memory_order_acquire))
+            return nullptr;
+
+        return &m_packets[m_readIndex];
+    }
+
+    /**
+     * Render thread. Signals the packet from AcquireReadPacket is no longer in use
+     */
+    void ReleaseReadPacket()
+    {
+        m_renderIdle.release();
+    }
+
+    /**
+     * Simulation thread. Waits for the render thread to finish its current packet
+     */
+    void Flush()
+    {
+        m_renderIdle.acquire();
+        m_renderIdle.release();
+    }
+
+    /**
+     * Wakes the render thread so it can observe shutdown
+     * @note Must be called from the simulation thread, like Publish
+     */
+    void Shutdown()
+    {
+        // Once the render thread is idle it has consumed every published packet, so the
+        // wake-up below can't overflow m_packetReady
+        m_renderIdle.acquire();
+
+        m_shutdown.store(true, std::memory_order_release);
+        m_packetReady.release();
+    }
+
+private:
+    std::array<FramePacket, 2> m_packets;
+    uint32_t m_writeIndex = 0;
+    uint32_t m_readIndex = 1;
+
+    std::binary_semaphore m_packetReady {0};
+    std::binary_semaphore m_renderIdle {1};
+    std::atomic<bool> m_shutdown = false;
+};
+} // namespace sj
@@ -0,0 +1,555 @@
+module;
+
+#include <ScrewjankStd/Assert.hpp>
+#include <ScrewjankStd/PlatformDetection.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#ifdef SJ_SIMD_AVX2
+    #include <immintrin.h>
+#endif
+
+export module sj.engine.rendering.OcclusionBuffer;
+import sj.engine.system.threading.ParallelAlgorithms;
+import sj.std.containers.vector;
+import sj.std.math;
+
+export namespace sj
+{
+/**
+ * Low resolution software depth buffer for CPU occlusion culling.
+ *
+ * Each frame: Begin, AddOccluder for every occluder, Rasterize, then test occludees with
+ * IsVisible or CullOccluded.
+ *
+ * Depth is stored as 1/w, which interpolates linearly in screen space and doesn't depend on how
+ * the projection maps z. Larger is nearer and 0 is infinitely far. The buffer is split into 8x8
+ * tiles that are binned and rasterized in parallel, and each tile also keeps its farthest depth
+ * so most occludee tests never touch pixels.
+ *
+ * Occluder triangles are clipped just in front of the camera, so walls and floors reaching past
+ * it still occlude. 1/w stays valid beyond the far plane, so nothing is dropped there.
+ * Pixel centers exactly on an edge shared by two triangles go to exactly one of them, so meshes
+ * don't leak through their diagonals
+ */
+class OcclusionBuffer
+{
+public:
+    static constexpr int32_t kTileSize = 8;
+
+    /**
+     * @param width Pixels, multiple of kTileSize
+     * @param height Pixels, multiple of kTileSize
+     */
+    explicit OcclusionBuffer(uint32_t width = 256, uint32_t height = 128)
+        : m_width(width), m_height(height), m_tilesX(width / kTileSize),
+          m_tilesY(height / kTileSize)
+    {
+        SJ_ASSERT(width % kTileSize == 0 && height % kTileSize == 0,
+                  "Occlusion buffer size must be a multiple of the tile size");
+
+        m_depth.resize(static_cast<size_t>(width) * height, 0.0f);
+        m_tileFarthest.resize(static_cast<size_t>(m_tilesX) * m_tilesY, 0.0f);
+    }
+
+    /**
+     * Starts a new frame. Occluders and occludees are projected with viewProjection
+     */
+    void Begin(const Mat44& viewProjection)
+    {
+        m_viewProjection = viewProjection;
+        m_triangles.clear();
+    }
+
+    /**
+     * Projects and sets up an occluder's triangles. Nothing is drawn until Rasterize
+     * @param positions Model space vertex positions
+     * @param indices Triangle list into positions
+     */
+    void AddOccluder(std::span<const Vec3> positions,
+                     std::span<const uint16_t> indices,
+                     const Mat44& localToWorld)
+    {
+        SJ_ASSERT(indices.size() % 3 == 0, "Occluder indices must be a triangle list");
+        SJ_ASSERT(std::ranges::all_of(indices,
+                                      [&](uint16_t index) { return index < positions.size(); }),
+                  "Occluder index out of range of its positions");
+
+        const Mat44 localToClip = localToWorld * m_viewProjection;
+
+        m_clipVertices.resize(positions.size());
+        for(size_t i = 0; i < positions.size(); i++)
+            m_clipVertices[i] = Vec4(positions[i], 1.0f) * localToClip;
+
+        for(size_t i = 0; i + 2 < indices.size(); i += 3)
+        {
+            ClipAndSetupTriangle(m_clipVertices[indices[i]],
+                                 m_clipVertices[indices[i + 1]],
+                                 m_clipVertices[indices[i + 2]]);
+        }
+    }
+
+    /**
+     * Bins the frame's triangles into tiles, then rasterizes tiles across the job system
+     */
+    void Rasterize()
+    {
+        const size_t numTiles = m_tileFarthest.size();
+
+        // Counting sort of triangle indices by tile
+        m_binOffsets.resize(numTiles + 1);
+        std::fill(m_binOffsets.begin(), m_binOffsets.end(), 0u);
+
+        ForEachBinnedTile([this](uint32_t tile, uint32_t) { m_binOffsets[tile + 1]++; });
+
+        for(size_t tile = 0; tile < numTiles; tile++)
+            m_binOffsets[tile + 1] += m_binOffsets[tile];
+
+        m_binCursors.resize(numTiles);
+        std::copy(m_binOffsets.begin(), m_binOffsets.end() - 1, m_binCursors.begin());
+
+        m_binnedTriangles.resize(m_binOffsets[numTiles]);
+        ForEachBinnedTile([this](uint32_t tile, uint32_t triangle) {
+            m_binnedTriangles[m_binCursors[tile]++] = triangle;
+        });
+
+        // Tiles own disjoint pixels, so they rasterize without synchronization
+        ParallelFor(numTiles, [this](size_t tile) { RasterizeTile(tile); }, kTilesPerJob);
+    }
+
+    /**
+     * @return False if bounds is certainly hidden behind rasterized occluders
+     */
+    [[nodiscard]] bool IsVisible(const AABB& bounds) const
+    {
+        float minX = static_cast<float>(m_width);
+        float minY = static_cast<float>(m_height);
+        float maxX = 0.0f;
+        float maxY = 0.0f;
+        float nearestDepth = 0.0f;
+
+        for(int corner = 0; corner < 8; corner++)
+        {
+            const Vec4 clip = Vec4((corner & 1) ? bounds.max.x : bounds.min.x,
+                                   (corner & 2) ? bounds.max.y : bounds.min.y,
+                                   (corner & 4) ? bounds.max.z : bounds.min.z,
+                                   1.0f) *
+                              m_viewProjection;
+
+            // Boxes reaching behind the camera are never culled
+            if(!IsInFrontOfCamera(clip))
+                return true;
+
+            const ScreenVertex v = ToScreen(clip);
+            minX = std::min(minX, v.x);
+            minY = std::min(minY, v.y);
+            maxX = std::max(maxX, v.x);
+            maxY = std::max(maxY, v.y);
+            nearestDepth = std::max(nearestDepth, v.depth);
+        }
+
+        // Off screen parts can't be occluded, and frustum culling has already handled the rest
+        const int32_t pixelMinX = std::max(0, ToPixel(minX, m_width));
+        const int32_t pixelMinY = std::max(0, ToPixel(minY, m_height));
+        const int32_t pixelMaxX =
+            std::min(static_cast<int32_t>(m_width) - 1, ToPixel(maxX, m_width));
+        const int32_t pixelMaxY =
+            std::min(static_cast<int32_t>(m_height) - 1, ToPixel(maxY, m_height));
+
+        if(pixelMinX > pixelMaxX || pixelMinY > pixelMaxY)
+            return true;
+
+        for(int32_t tileY = pixelMinY / kTileSize; tileY <= pixelMaxY / kTileSize; tileY++)
+        {
+            for(int32_t tileX = pixelMinX / kTileSize; tileX <= pixelMaxX / kTileSize; tileX++)
+            {
+                const size_t tile = static_cast<size_t>(tileY) * m_tilesX + tileX;
+                if(nearestDepth < m_tileFarthest[tile])
+                    continue;
+
+                const int32_t x0 = tileX * kTileSize;
+                const int32_t y0 = tileY * kTileSize;
+                if(IsAnyPixelBehind(tile,
+                                    std::max(pixelMinX, x0) - x0,
+                                    std::min(pixelMaxX, x0 + kTileSize - 1) - x0,
+                                    std::max(pixelMinY, y0) - y0,
+                                    std::min(pixelMaxY, y0 + kTileSize - 1) - y0,
+                                    nearestDepth))
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * Writes the candidates that aren't occluded to outVisible, keeping their order.
+     * outVisible may be the same span as candidates
+     * @param candidates Indices into boxes, e.g. from CullAABBs
+     * @return Number of indices written
+     */
+    size_t CullOccluded(std::span<const AABB> boxes,
+                        std::span<const uint32_t> candidates,
+                        std::span<uint32_t> outVisible) const
+    {
+        SJ_ASSERT(outVisible.size() >= candidates.size(), "Output span is too small");
+
+        size_t numVisible = 0;
+        for(uint32_t index : candidates)
+        {
+            if(IsVisible(boxes[index]))
+                outVisible[numVisible++] = index;
+        }
+
+        return numVisible;
+    }
+
+    /** Stored 1/w of a pixel. 0 where nothing was drawn */
+    [[nodiscard]] float GetDepth(uint32_t x, uint32_t y) const
+    {
+        const uint32_t tile = (y / kTileSize) * m_tilesX + x / kTileSize;
+        return m_depth[tile * kTileSize * kTileSize + (y % kTileSize) * kTileSize + x % kTileSize];
+    }
+
+    /** Triangles that survived setup this frame */
+    [[nodiscard]] size_t GetNumTriangles() const
+    {
+        return m_triangles.size();
+    }
+
+    [[nodiscard]] uint32_t GetWidth() const
+    {
+        return m_width;
+    }
+
+    [[nodiscard]] uint32_t GetHeight() const
+    {
+        return m_height;
+    }
+
+private:
+    static constexpr size_t kTilesPerJob = 8;
+
+    /**
+     * Occluders are clipped at this w rather than at the near plane, whose clip space z differs
+     * between standard and reversed Z. Large enough that clipped vertices still project to
+     * coordinates the edge functions resolve to well under a pixel
+     */
+    static constexpr float kNearClipW = 1e-3f;
+
+    struct ScreenVertex
+    {
+        float x;
+        float y;
+        float depth;
+    };
+
+    /**
+     * Edge functions E(x, y) = a * x + b * y + c are positive inside, and depth is the plane
+     * a * x + b * y + c through the three vertices.
+     *
+     * A shared edge has exactly negated coefficients in its other triangle, so where E is 0 the
+     * pixel goes to whichever side has edgeOwnsTies set
+     */
+    struct Triangle
+    {
+        float edgeA[3];
+        float edgeB[3];
+        float edgeC[3];
+        bool edgeOwnsTies[3];
+
+        float depthA;
+        float depthB;
+        float depthC;
+
+        // Inclusive pixel bounds, clamped to the buffer
+        int32_t minX;
+        int32_t minY;
+        int32_t maxX;
+        int32_t maxY;
+    };
+
+    /**
+     * Pixel containing screen coordinate v. Clamped to just outside the buffer first, since
+     * vertices close to the camera can project arbitrarily far off screen
+     */
+    [[nodiscard]] static int32_t ToPixel(float v, uint32_t size)
+    {
+        return static_cast<int32_t>(std::floor(std::clamp(v, -1.0f, static_cast<float>(size))));
+    }
+
+    [[nodiscard]] static bool IsInFrontOfCamera(const Vec4& clip)
+    {
+        return clip.GetW() > kNearClipW;
+    }
+
+    /**
+     * Where the edge from inside to outside crosses w = kNearClipW. Always interpolating from the
+     * inside vertex gives both triangles sharing an edge the same point
+     */
+    [[nodiscard]] static Vec4 ClipToNear(const Vec4& inside, const Vec4& outside)
+    {
+        const float t = (inside.GetW() - kNearClipW) / (inside.GetW() - outside.GetW());
+        const Vec4 clipped = inside + (outside - inside) * t;
+        return Vec4(clipped.GetX(), clipped.GetY(), clipped.GetZ(), kNearClipW);
+    }
+
+    /** Pixel coordinates with y down, and 1/w */
+    [[nodiscard]] ScreenVertex ToScreen(const Vec4& clip) const
+    {
+        const float invW = 1.0f / clip.GetW();
+        return {.x = (clip.GetX() * invW * 0.5f + 0.5f) * static_cast<float>(m_width),
+                .y = (0.5f - clip.GetY() * invW * 0.5f) * static_cast<float>(m_height),
+                .depth = invW};
+    }
+
+    /**
+     * Clips a triangle to the part in front of the camera, then sets up the one or two triangles
+     * that leaves
+     */
+    void ClipAndSetupTriangle(const Vec4& clip0, const Vec4& clip1, const Vec4& clip2)
+    {
+        const Vec4 verts[3] = {clip0, clip1, clip2};
+
+        Vec4 clipped[4];
+        int numClipped = 0;
+        for(int i = 0; i < 3; i++)
+        {
+            const Vec4& a = verts[i];
+            const Vec4& b = verts[(i + 1) % 3];
+            const bool isAInside = IsInFrontOfCamera(a);
+
+            if(isAInside)
+                clipped[numClipped++] = a;
+
+            if(isAInside != IsInFrontOfCamera(b))
+                clipped[numClipped++] = isAInside ? ClipToNear(a, b) : ClipToNear(b, a);
+        }
+
+        if(numClipped >= 3)
+            SetupTriangle(clipped[0], clipped[1], clipped[2]);
+
+        if(numClipped == 4)
+            SetupTriangle(clipped[0], clipped[2], clipped[3]);
+    }
+
+    void SetupTriangle(const Vec4& clip0, const Vec4& clip1, const Vec4& clip2)
+    {
+        const ScreenVertex v0 = ToScreen(clip0);
+        ScreenVertex v1 = ToScreen(clip1);
+        ScreenVertex v2 = ToScreen(clip2);
+
+        float area = (v1.x - v0.x) * (v2.y - v0.y) - (v2.x - v0.x) * (v1.y - v0.y);
+        if(std::abs(area) < 1e-6f)
+            return;
+
+        // Occluders draw both faces. Wind everything the same way so inside is always positive
+        if(area < 0.0f)
+        {
+            std::swap(v1, v2);
+            area = -area;
+        }
+
+        Triangle tri;
+        tri.minX = std::max(0, ToPixel(std::min({v0.x, v1.x, v2.x}), m_width));
+        tri.minY = std::max(0, ToPixel(std::min({v0.y, v1.y, v2.y}), m_height));
+        tri.maxX = std::min(static_cast<int32_t>(m_width) - 1,
+                            ToPixel(std::max({v0.x, v1.x, v2.x}), m_width));
+        tri.maxY = std::min(static_cast<int32_t>(m_height) - 1,
+                            ToPixel(std::max({v0.y, v1.y, v2.y}), m_height));
+
+        if(tri.minX > tri.maxX || tri.minY > tri.maxY)
+            return;
+
+        const ScreenVertex verts[3] = {v0, v1, v2};
+        for(int edge = 0; edge < 3; edge++)
+        {
+            const ScreenVertex& a = verts[edge];
+            const ScreenVertex& b = verts[(edge + 1) % 3];
+            tri.edgeA[edge] = a.y - b.y;
+            tri.edgeB[edge] = b.x - a.x;
+            tri.edgeC[edge] = a.x * b.y - a.y * b.x;
+            tri.edgeOwnsTies[edge] =
+                tri.edgeA[edge] > 0.0f || (tri.edgeA[edge] == 0.0f && tri.edgeB[edge] > 0.0f);
+        }
+
+        const float invArea = 1.0f / area;
+        const float dz1 = v1.depth - v0.depth;
+        const float dz2 = v2.depth - v0.depth;
+        tri.depthA = (dz1 * (v2.y - v0.y) - dz2 * (v1.y - v0.y)) * invArea;
+        tri.depthB = (dz2 * (v1.x - v0.x) - dz1 * (v2.x - v0.x)) * invArea;
+        tri.depthC = v0.depth - tri.depthA * v0.x - tri.depthB * v0.y;
+
+        m_triangles.push_back(tri);
+    }
+
+    /** Calls fn(tile, triangleIndex) for every tile each triangle's bounds touch */
+    template <class Fn>
+    void ForEachBinnedTile(Fn&& fn) const
+    {
+        for(size_t i = 0; i < m_triangles.size(); i++)
+        {
+            const Triangle& tri = m_triangles[i];
+            for(int32_t tileY = tri.minY / kTileSize; tileY <= tri.maxY / kTileSize; tileY++)
+            {
+                for(int32_t tileX = tri.minX / kTileSize; tileX <= tri.maxX / kTileSize; tileX++)
+                {
+                    fn(static_cast<uint32_t>(tileY) * m_tilesX + tileX, static_cast<uint32_t>(i));
+                }
+            }
+        }
+    }
+
+    void RasterizeTile(size_t tile)
+    {
+        float* depth = &m_depth[tile * kTileSize * kTileSize];
+        std::fill(depth, depth + kTileSize * kTileSize, 0.0f);
+
+        const int32_t x0 = static_cast<int32_t>(tile % m_tilesX) * kTileSize;
+        const int32_t y0 = static_cast<int32_t>(tile / m_tilesX) * kTileSize;
+
+#ifdef SJ_SIMD_AVX2
+        static_assert(kTileSize == 8, "One AVX2 register per tile row");
+
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 px = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x0) + 0.5f),
+                                        _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7));
+#endif
+
+        for(uint32_t bin = m_binOffsets[tile]; bin < m_binOffsets[tile + 1]; bin++)
+        {
+            const Triangle& tri = m_triangles[m_binnedTriangles[bin]];
+
+            const int32_t rowBegin = std::max(y0, tri.minY);
+            const int32_t rowEnd = std::min(y0 + kTileSize, tri.maxY + 1);
+
+#ifdef SJ_SIMD_AVX2
+            __m256 edgeRow[3];
+            __m256 edgeStep[3];
+            __m256 edgeTies[3];
+            for(int edge = 0; edge < 3; edge++)
+            {
+                edgeRow[edge] = _mm256_fmadd_ps(_mm256_set1_ps(tri.edgeA[edge]),
+                                                px,
+                                                _mm256_set1_ps(tri.edgeC[edge]));
+                edgeStep[edge] = _mm256_set1_ps(tri.edgeB[edge]);
+                edgeTies[edge] =
+                    _mm256_castsi256_ps(_mm256_set1_epi32(tri.edgeOwnsTies[edge] ? -1 : 0));
+            }
+
+            auto isInside = [&](int edge, __m256 py) {
+                const __m256 e = _mm256_fmadd_ps(edgeStep[edge], py, edgeRow[edge]);
+                return _mm256_or_ps(
+                    _mm256_cmp_ps(e, zero, _CMP_GT_OQ),
+                    _mm256_and_ps(_mm256_cmp_ps(e, zero, _CMP_EQ_OQ), edgeTies[edge]));
+            };
+
+            const __m256 depthRow = _mm256_fmadd_ps(_mm256_set1_ps(tri.depthA),
+                                                    px,
+                                                    _mm256_set1_ps(tri.depthC));
+            const __m256 depthStep = _mm256_set1_ps(tri.depthB);
+
+            for(int32_t y = rowBegin; y < rowEnd; y++)
+            {
+                const __m256 py = _mm256_set1_ps(static_cast<float>(y) + 0.5f);
+
+                const __m256 inside = _mm256_and_ps(
+                    _mm256_and_ps(isInside(0, py), isInside(1, py)), isInside(2, py));
+
+                float* row = depth + (y - y0) * kTileSize;
+                const __m256 current = _mm256_loadu_ps(row);
+                const __m256 nearest =
+                    _mm256_max_ps(current, _mm256_fmadd_ps(depthStep, py, depthRow));
+                _mm256_storeu_ps(row, _mm256_blendv_ps(current, nearest, inside));
+            }
+#else
+            for(int32_t y = rowBegin; y < rowEnd; y++)
+            {
+                const float py = static_cast<float>(y) + 0.5f;
+                float* row = depth + (y - y0) * kTileSize;
+
+                for(int32_t x = 0; x < kTileSize; x++)
+                {
+                    const float px = static_cast<float>(x0 + x) + 0.5f;
+
+                    auto isInside = [&](int edge) {
+                        const float e =
+                            tri.edgeA[edge] * px + tri.edgeB[edge] * py + tri.edgeC[edge];
+                        return e > 0.0f || (e == 0.0f && tri.edgeOwnsTies[edge]);
+                    };
+
+                    if(isInside(0) && isInside(1) && isInside(2))
+                        row[x] = std::max(row[x], tri.depthA * px + tri.depthB * py + tri.depthC);
+                }
+            }
+#endif
+        }
+
+        m_tileFarthest[tile] = *std::min_element(depth, depth + kTileSize * kTileSize);
+    }
+
+    /**
+     * @return True if any pixel of tile in the inclusive tile local rect is at or behind depth
+     */
+    [[nodiscard]] bool IsAnyPixelBehind(size_t tile,
+                                        int32_t minX,
+                                        int32_t maxX,
+                                        int32_t minY,
+                                        int32_t maxY,
+                                        float depth) const
+    {
+        const float* tileDepth = &m_depth[tile * kTileSize * kTileSize];
+
+#ifdef SJ_SIMD_AVX2
+        const __m256 lanes = _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256 columns = _mm256_and_ps(
+            _mm256_cmp_ps(lanes, _mm256_set1_ps(static_cast<float>(minX)), _CMP_GE_OQ),
+            _mm256_cmp_ps(lanes, _mm256_set1_ps(static_cast<float>(maxX)), _CMP_LE_OQ));
+        const __m256 occludeeDepth = _mm256_set1_ps(depth);
+
+        for(int32_t y = minY; y <= maxY; y++)
+        {
+            const __m256 row = _mm256_loadu_ps(tileDepth + y * kTileSize);
+            const __m256 behind = _mm256_cmp_ps(occludeeDepth, row, _CMP_GE_OQ);
+            if(_mm256_movemask_ps(_mm256_and_ps(behind, columns)) != 0)
+                return true;
+        }
+#else
+        for(int32_t y = minY; y <= maxY; y++)
+        {
+            for(int32_t x = minX; x <= maxX; x++)
+            {
+                if(depth >= tileDepth[y * kTileSize + x])
+                    return true;
+            }
+        }
+#endif
+
+        return false;
+    }
+
+    uint32_t m_width;
+    uint32_t m_height;
+    uint32_t m_tilesX;
+    uint32_t m_tilesY;
+
+    Mat44 m_viewProjection = Mat44(kIdentityTag);
+
+    /** Tile major: each tile's 8x8 pixels are contiguous, row by row */
+    dynamic_vector<float> m_depth;
+    dynamic_vector<float> m_tileFarthest;
+
+    dynamic_vector<Vec4> m_clipVertices;
+    dynamic_vector<Triangle> m_triangles;
+
+    dynamic_vector<uint32_t> m_binOffsets;
+    dynamic_vector<uint32_t> m_binCursors;
+    dynamic_vector<uint32_t> m_binnedTriangles;
+};
+} // namespace sj
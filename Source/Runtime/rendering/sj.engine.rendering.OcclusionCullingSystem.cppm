@@ -0,0 +1,84 @@
+module;
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+export module sj.engine.rendering.OcclusionCullingSystem;
+import sj.engine.core.BoundsComponent;
+import sj.engine.core.OccluderComponent;
+import sj.engine.core.TransformComponent;
+import sj.engine.rendering.OcclusionBuffer;
+
+import sj.std.containers.vector;
+import sj.std.math;
+import sj.engine.ecs.ECSRegistry;
+import sj.engine.ecs.Identifiers;
+
+export namespace sj
+{
+    /**
+     * Removes game objects hidden behind OccluderComponents from a candidate list, normally the
+     * frustum culled set from CullingSystem. Runs on the CPU, so it's usable headless
+     */
+    class OcclusionCullingSystem
+    {
+    public:
+        /**
+         * @param viewProjection World to clip space matrix of the camera being culled against
+         * @param candidates Game objects to test. Ones without bounds are always kept
+         */
+        void Process(ECSRegistry& registry,
+                     const Mat44& viewProjection,
+                     std::span<const GameObjectId> candidates)
+        {
+            m_buffer.Begin(viewProjection);
+
+            for(const auto& [goId, occluder] : registry.GetComponents<OccluderComponent>())
+            {
+                const TransformComponent* transform =
+                    registry.GetComponent<TransformComponent>(goId);
+                if(transform == nullptr)
+                    continue;
+
+                m_buffer.AddOccluder(occluder.positions,
+                                     occluder.indices,
+                                     transform->localToParentTransform.ToMat44());
+            }
+
+            m_buffer.Rasterize();
+
+            // An occluder's own bounds are never behind it, since its nearest corner is at least
+            // as near as any point of the proxy
+            m_visibleGameObjects.clear();
+            for(GameObjectId goId : candidates)
+            {
+                const BoundsComponent* bounds = registry.GetComponent<BoundsComponent>(goId);
+                const TransformComponent* transform =
+                    registry.GetComponent<TransformComponent>(goId);
+
+                if(bounds == nullptr || transform == nullptr ||
+                   m_buffer.IsVisible(TransformAABB(bounds->localBounds,
+                                                    transform->localToParentTransform.ToMat44())))
+                {
+                    m_visibleGameObjects.push_back(goId);
+                }
+            }
+        }
+
+        /** Candidates that passed the last Process, in candidate order */
+        [[nodiscard]] std::span<const GameObjectId> GetVisibleGameObjects() const
+        {
+            return m_visibleGameObjects;
+        }
+
+        [[nodiscard]] const OcclusionBuffer& GetOcclusionBuffer() const
+        {
+            return m_buffer;
+        }
+
+    private:
+        OcclusionBuffer m_buffer;
+        dynamic_vector<GameObjectId> m_visibleGameObjects;
+    };
+} // namespace sj
@@ -3,6 +3,9 @@ module;
 export module sj.engine.rendering;
 export import sj.engine.rendering.BufferResource;
 export import sj.engine.rendering.Events;
+export import sj.engine.rendering.FramePacket;
+export import sj.engine.rendering.OcclusionBuffer;
+export import sj.engine.rendering.OcclusionCullingSystem;
 export import sj.engine.rendering.Renderer;
 export import sj.engine.rendering.Events;
 export import sj.engine.rendering.SamplerResource;
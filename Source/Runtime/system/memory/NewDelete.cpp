@@ -3,6 +3,9 @@
 #include <memory_resource>
 
 import sj.engine.system.memory.MemorySystem;
+#ifndef SJ_GOLD
+import sj.engine.system.memory.AllocationTracker;
+#endif
 import sj.std.memory.resources;
 
 [[nodiscard]] void* do_allocate(size_t count, size_t alignment = alignof(std::max_align_t))
@@ -11,7 +14,18 @@ import sj.std.memory.resources;
         count++;
 
     std::pmr::memory_resource* resource = sj::MemorySystem::GetCurrentMemoryResource();
-    return resource->allocate(count, alignment);
+    void* memory = resource->allocate(count, alignment);
+
+#ifndef SJ_GOLD
+    sj::MemorySystem::RecordGlobalNew();
+
+    // Attached resources report to the tracker themselves
+    sj::AllocationTracker* tracker = sj::MemorySystem::GetAllocationTracker();
+    if(tracker && !tracker->IsAttached(resource))
+        tracker->RecordAllocation(memory, count);
+#endif
+
+    return memory;
 }
 
 [[nodiscard]] void* operator new(std::size_t count) noexcept(false)
@@ -64,6 +78,13 @@ void do_deallocate(void* ptr,
         return;
 
     sj::memory_resource* owning_resource = sj::MemorySystem::FindOwningResource(ptr);
+
+#ifndef SJ_GOLD
+    sj::AllocationTracker* tracker = sj::MemorySystem::GetAllocationTracker();
+    if(tracker && !tracker->IsAttached(owning_resource))
+        tracker->RecordDeallocation(ptr);
+#endif
+
     if(owning_resource)
         owning_resource->deallocate(ptr, sz);
     else
@@ -0,0 +1,329 @@
+module;
+
+#include <ScrewjankStd/Assert.hpp>
+#include <ScrewjankStd/Log.hpp>
+#include <ScrewjankStd/PlatformDetection.hpp>
+
+#if defined(SJ_PLATFORM_LINUX)
+    #include <execinfo.h>
+#elif defined(SJ_PLATFORM_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+export module sj.engine.system.memory.AllocationTracker;
+import sj.std.memory.resources;
+import sj.std.containers.stack;
+import sj.std.containers.vector;
+import sj.std.hash;
+
+#ifndef SJ_GOLD
+export namespace sj
+{
+/**
+ * Records every live allocation made through attached resources and the global operator new.
+ * Each record carries the active memory tag and, for one in every kCallstackSampleInterval
+ * allocations, a captured callstack. Records live in a side table backed by the system heap so
+ * tracking never re-enters the allocators it is observing.
+ */
+class AllocationTracker final : public allocation_listener
+{
+public:
+    static constexpr size_t kMaxCallstackDepth = 16;
+    static constexpr uint32_t kCallstackSampleInterval = 64;
+    static constexpr const char* kUntagged = "Untagged";
+
+    /** Aggregate of all live allocations sharing a tag and callstack */
+    struct AllocationSite
+    {
+        const char* tag = kUntagged;
+        uint64_t callstackHash = 0;
+        size_t totalBytes = 0;
+        size_t count = 0;
+    };
+
+    AllocationTracker()
+        : m_liveAllocations(&m_internalResource), m_callstacks(&m_internalResource)
+    {
+    }
+
+    AllocationTracker(const AllocationTracker& other) = delete;
+    AllocationTracker(AllocationTracker&& other) = delete;
+    ~AllocationTracker() override = default;
+
+    /**
+     * Begin listening to allocations serviced by resource
+     */
+    void Attach(memory_resource* resource)
+    {
+        SJ_ASSERT(!IsAttached(resource), "Resource is already tracked");
+        m_attachedResources.emplace_back(resource);
+        resource->set_allocation_listener(this);
+    }
+
+    /**
+     * @return Whether resource reports its allocations to this tracker through the listener
+     */
+    [[nodiscard]] bool IsAttached(const std::pmr::memory_resource* resource) const
+    {
+        return std::ranges::find(m_attachedResources, resource) != m_attachedResources.end();
+    }
+
+    void RecordAllocation(void* ptr, size_t bytes, const char* fallbackTag = kUntagged)
+    {
+        if(ptr == nullptr || s_isRecording)
+            return;
+
+        s_isRecording = true;
+
+        const char* tag = GetCurrentTag();
+        if(tag == nullptr)
+            tag = fallbackTag;
+
+        // Only pay for the stack walk on a fraction of allocations
+        Callstack callstack;
+        if(++s_sampleCounter % kCallstackSampleInterval == 0)
+            callstack = CaptureCallstack();
+
+        {
+            std::scoped_lock lock(m_mutex);
+
+            if(callstack.depth > 0)
+                m_callstacks.try_emplace(callstack.hash, callstack);
+
+            m_liveAllocations.insert_or_assign(
+                ptr,
+                AllocationRecord {.bytes = bytes, .tag = tag, .callstackHash = callstack.hash});
+        }
+
+        s_isRecording = false;
+    }
+
+    void RecordDeallocation(void* ptr)
+    {
+        if(ptr == nullptr || s_isRecording)
+            return;
+
+        std::scoped_lock lock(m_mutex);
+        m_liveAllocations.erase(ptr);
+    }
+
+    void on_allocate(const memory_resource& resource,
+                     void* ptr,
+                     size_t bytes,
+                     [[maybe_unused]] size_t alignment) override
+    {
+        RecordAllocation(ptr, bytes, resource.get_debug_name());
+    }
+
+    void on_deallocate([[maybe_unused]] const memory_resource& resource,
+                       void* ptr,
+                       [[maybe_unused]] size_t bytes) override
+    {
+        RecordDeallocation(ptr);
+    }
+
+    [[nodiscard]] size_t GetLiveAllocationCount() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_liveAllocations.size();
+    }
+
+    [[nodiscard]] size_t GetLiveBytes() const
+    {
+        std::scoped_lock lock(m_mutex);
+
+        size_t total = 0;
+        for(const auto& [ptr, record] : m_liveAllocations)
+            total += record.bytes;
+
+        return total;
+    }
+
+    /**
+     * Groups live allocations by tag and callstack and writes the heaviest sites to out
+     * @return The number of sites written
+     */
+    size_t CollectTopSites(std::span<AllocationSite> out) const
+    {
+        std::pmr::vector<AllocationSite> sites(&m_internalResource);
+
+        {
+            std::scoped_lock lock(m_mutex);
+
+            for(const auto& [ptr, record] : m_liveAllocations)
+            {
+                auto it = std::ranges::find_if(sites, [&record](const AllocationSite& site) {
+                    return site.tag == record.tag && site.callstackHash == record.callstackHash;
+                });
+
+                if(it == sites.end())
+                {
+                    sites.emplace_back(record.tag, record.callstackHash, record.bytes, 1);
+                }
+                else
+                {
+                    it->totalBytes += record.bytes;
+                    it->count++;
+                }
+            }
+        }
+
+        const size_t numSites = std::min(out.size(), sites.size());
+        std::ranges::partial_sort(sites,
+                                  sites.begin() + static_cast<ptrdiff_t>(numSites),
+                                  std::ranges::greater {},
+                                  &AllocationSite::totalBytes);
+        std::ranges::copy_n(sites.begin(), static_cast<ptrdiff_t>(numSites), out.begin());
+
+        return numSites;
+    }
+
+    /**
+     * Logs the topN allocation sites by live bytes, including sampled callstacks
+     */
+    void ReportTopSites(size_t topN) const
+    {
+        std::pmr::vector<AllocationSite> sites(topN, &m_internalResource);
+        sites.resize(CollectTopSites(sites));
+
+        SJ_ENGINE_LOG_INFO("Top {} allocation sites by live bytes:", sites.size());
+        for(const AllocationSite& site : sites)
+        {
+            SJ_ENGINE_LOG_INFO("  [{}] {} bytes in {} allocations",
+                               site.tag,
+                               site.totalBytes,
+                               site.count);
+            LogCallstack(site.callstackHash);
+        }
+    }
+
+    /**
+     * Logs every allocation still alive, grouped by site
+     */
+    void ReportLeaks(size_t topN = 32) const
+    {
+        const size_t liveCount = GetLiveAllocationCount();
+        if(liveCount == 0)
+        {
+            SJ_ENGINE_LOG_INFO("No leaked allocations detected");
+            return;
+        }
+
+        SJ_ENGINE_LOG_WARN("{} allocations ({} bytes) are still alive",
+                           liveCount,
+                           GetLiveBytes());
+        ReportTopSites(topN);
+    }
+
+    static void PushTag(const char* tag)
+    {
+        s_tagStack.push(tag);
+    }
+
+    static void PopTag()
+    {
+        s_tagStack.pop();
+    }
+
+    /**
+     * @return The innermost memory tag on this thread, or nullptr if none is active
+     */
+    [[nodiscard]] static const char* GetCurrentTag()
+    {
+        return s_tagStack.empty() ? nullptr : s_tagStack.top();
+    }
+
+private:
+    struct AllocationRecord
+    {
+        size_t bytes = 0;
+        const char* tag = kUntagged;
+        uint64_t callstackHash = 0;
+    };
+
+    struct Callstack
+    {
+        std::array<void*, kMaxCallstackDepth> frames = {};
+        uint32_t depth = 0;
+        uint64_t hash = 0;
+    };
+
+    static Callstack CaptureCallstack()
+    {
+        Callstack callstack;
+
+#if defined(SJ_PLATFORM_LINUX)
+        const int depth = backtrace(callstack.frames.data(), kMaxCallstackDepth);
+        callstack.depth = depth > 0 ? static_cast<uint32_t>(depth) : 0;
+#elif defined(SJ_PLATFORM_WINDOWS)
+        callstack.depth =
+            RtlCaptureStackBackTrace(0, kMaxCallstackDepth, callstack.frames.data(), nullptr);
+#endif
+
+        if(callstack.depth > 0)
+        {
+            std::span frames(callstack.frames.data(), callstack.depth);
+            callstack.hash = WyHash64(std::as_bytes(frames));
+        }
+
+        return callstack;
+    }
+
+    void LogCallstack(uint64_t callstackHash) const
+    {
+        if(callstackHash == 0)
+            return;
+
+        Callstack callstack;
+        {
+            std::scoped_lock lock(m_mutex);
+            auto it = m_callstacks.find(callstackHash);
+            if(it == m_callstacks.end())
+                return;
+
+            callstack = it->second;
+        }
+
+#if defined(SJ_PLATFORM_LINUX)
+        char** symbols =
+            backtrace_symbols(callstack.frames.data(), static_cast<int>(callstack.depth));
+        for(uint32_t i = 0; i < callstack.depth; i++)
+        {
+            SJ_ENGINE_LOG_INFO("      {}", symbols ? symbols[i] : "???");
+        }
+        std::free(symbols); // NOLINT
+#else
+        for(uint32_t i = 0; i < callstack.depth; i++)
+        {
+            SJ_ENGINE_LOG_INFO("      {}", callstack.frames[i]);
+        }
+#endif
+    }
+
+    inline static thread_local static_stack<const char*, 64> s_tagStack = {};
+    inline static thread_local uint32_t s_sampleCounter = 0;
+    inline static thread_local bool s_isRecording = false;
+
+    /** Book-keeping memory comes straight from the system heap to avoid tracking itself */
+    mutable system_allocator m_internalResource;
+    mutable std::mutex m_mutex;
+
+    std::pmr::unordered_map<void*, AllocationRecord> m_liveAllocations;
+    std::pmr::unordered_map<uint64_t, Callstack> m_callstacks;
+
+    static_vector<const std::pmr::memory_resource*, 8> m_attachedResources;
+};
+} // namespace sj
+#endif // !SJ_GOLD
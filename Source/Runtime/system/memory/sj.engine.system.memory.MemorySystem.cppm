@@ -1,7 +1,9 @@
 module;
 
 #include <ScrewjankStd/Assert.hpp>
+#include <ScrewjankStd/Log.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <memory_resource>
 
@@ -13,6 +15,10 @@ import sj.std.memory.utils;
 import sj.std.containers.stack;
 import sj.std.containers.vector;
 
+#ifndef SJ_GOLD
+import sj.engine.system.memory.AllocationTracker;
+#endif
+
 export namespace sj
 {
 // Root heap sizes
@@ -50,6 +56,48 @@ public:
     {
         return &(Get()->m_debugResource);
     }
+
+    /**
+     * @return The tracker recording live allocations, or nullptr if the memory system is not alive
+     */
+    static AllocationTracker* GetAllocationTracker()
+    {
+        return s_allocationTracker;
+    }
+
+    /**
+     * Logs the heaviest live allocation sites, grouped by memory tag and callstack
+     */
+    static void ReportAllocations(size_t topN = 16)
+    {
+        if(s_allocationTracker)
+            s_allocationTracker->ReportTopSites(topN);
+    }
+
+    /**
+     * Logs every allocation still alive. Intended to be called once owners have been torn down
+     */
+    static void ReportLeaks()
+    {
+        if(s_allocationTracker)
+            s_allocationTracker->ReportLeaks();
+    }
+
+    /**
+     * Called by the global operator new overrides, from any thread
+     */
+    static void RecordGlobalNew()
+    {
+        s_globalNewCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @return Allocations made through the global operator new so far, across all threads
+     */
+    [[nodiscard]] static size_t GetGlobalNewCount()
+    {
+        return s_globalNewCount.load(std::memory_order_relaxed);
+    }
 #endif
 
     static void TrackMemoryResource(sj::memory_resource* resource)
@@ -105,6 +153,11 @@ private:
 
     static MemorySystem* s_instance;
 
+#ifndef SJ_GOLD
+    inline static AllocationTracker* s_allocationTracker = nullptr;
+    inline static std::atomic<size_t> s_globalNewCount = 0;
+#endif
+
     MemorySystem(uint64_t rootHeapSize)
     {
         m_rootResource.init(rootHeapSize, m_unmanagedResource);
@@ -116,13 +169,27 @@ private:
         m_debugResource.init(kDebugHeapSize, m_unmanagedResource);
         m_debugResource.set_debug_name("Debug Heap");
         s_trackedResources.emplace_back(&m_debugResource);
+
+        m_allocationTracker.Attach(&m_rootResource);
+        s_allocationTracker = &m_allocationTracker;
 #endif
     }
 
-    ~MemorySystem() = default;
+    ~MemorySystem()
+    {
+#ifndef SJ_GOLD
+        s_allocationTracker = nullptr;
+        m_rootResource.set_allocation_listener(nullptr);
+#endif
+    }
 
     system_allocator m_unmanagedResource;
 
+#ifndef SJ_GOLD
+    // Declared before the heaps it observes so it outlives them
+    AllocationTracker m_allocationTracker;
+#endif
+
     free_list_allocator m_rootResource;
 
 #ifndef SJ_GOLD
@@ -132,18 +199,32 @@ private:
 
 /**
  * Helper class that pushes a memory resource onto the stack on create
- * and pops it when it goes out of scope
+ * and pops it when it goes out of scope.
+ * In non-gold builds the scope also tags allocations made inside it, defaulting to the debug
+ * name of the resource when it is an sj::memory_resource
  */
 class MemoryResourceScope
 {
 public:
-    MemoryResourceScope(std::pmr::memory_resource* resource) : m_resource(resource)
+    MemoryResourceScope(std::pmr::memory_resource* resource, const char* tag = nullptr)
+        : m_resource(resource), m_tag(tag)
     {
         MemorySystem::PushMemoryResource(resource);
+
+#ifndef SJ_GOLD
+        if(m_tag == nullptr)
+        {
+            if(auto* sjResource = dynamic_cast<sj::memory_resource*>(resource))
+                m_tag = sjResource->get_debug_name();
+        }
+
+        if(m_tag != nullptr)
+            AllocationTracker::PushTag(m_tag);
+#endif
     }
     MemoryResourceScope(const MemoryResourceScope& other) = delete;
     MemoryResourceScope(MemoryResourceScope&& other) noexcept
-        : MemoryResourceScope(other.m_resource)
+        : MemoryResourceScope(other.m_resource, other.m_tag)
     {
         other.m_resource = nullptr;
     }
@@ -152,6 +233,11 @@ public:
 
     ~MemoryResourceScope()
     {
+#ifndef SJ_GOLD
+        if(m_tag != nullptr)
+            AllocationTracker::PopTag();
+#endif
+
         MemorySystem::PopMemoryResource();
     }
 
@@ -180,6 +266,34 @@ public:
 
 private:
     std::pmr::memory_resource* m_resource;
+    const char* m_tag;
+};
+
+/**
+ * Attributes allocations made on this thread to tag for the lifetime of the scope.
+ * Compiles away in gold builds. Prefer the SJ_MEM_TAG macro.
+ */
+class MemoryTagScope
+{
+public:
+    explicit MemoryTagScope([[maybe_unused]] const char* tag)
+    {
+#ifndef SJ_GOLD
+        AllocationTracker::PushTag(tag);
+#endif
+    }
+
+    MemoryTagScope(const MemoryTagScope& other) = delete;
+    MemoryTagScope(MemoryTagScope&& other) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope& other) = delete;
+    MemoryTagScope& operator=(MemoryTagScope&& other) = delete;
+
+    ~MemoryTagScope()
+    {
+#ifndef SJ_GOLD
+        AllocationTracker::PopTag();
+#endif
+    }
 };
 
 } // namespace sj
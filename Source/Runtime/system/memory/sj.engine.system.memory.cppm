@@ -1,2 +1,3 @@
 export module sj.engine.system.memory;
+export import sj.engine.system.memory.AllocationTracker;
 export import sj.engine.system.memory.MemorySystem;
\ No newline at end of file
@@ -0,0 +1,412 @@
+module;
+
+#include <ScrewjankStd/Assert.hpp>
+#include <ScrewjankStd/Log.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+export module sj.engine.system.threading.JobSystem;
+import sj.engine.system.threading.ThreadContext;
+import sj.engine.system.threading.WorkStealingDeque;
+import sj.engine.system.memory.MemorySystem;
+import sj.std.memory.literals;
+import sj.std.memory.utils;
+import sj.std.containers.vector;
+
+export namespace sj
+{
+/**
+ * Coroutine suspended until a JobCounter reaches zero. Lives in the awaiting coroutine's frame
+ */
+struct JobCounterWaiter
+{
+    std::coroutine_handle<> handle;
+    JobCounterWaiter* next = nullptr;
+};
+
+/**
+ * Tracks outstanding jobs. Jobs scheduled against a counter increment it, and decrement it when
+ * they finish. A counter of zero means every job it was given has completed.
+ *
+ * Waiters may destroy the counter the moment it reports done, so the job that finishes it marks it
+ * done by closing the waiter list, and never touches it again after that
+ */
+class JobCounter
+{
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter& other) = delete;
+    JobCounter& operator=(const JobCounter& other) = delete;
+
+    [[nodiscard]] bool IsDone() const
+    {
+        return m_waiters.load(std::memory_order_acquire) == Closed();
+    }
+
+    [[nodiscard]] uint32_t GetValue() const
+    {
+        return m_value.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Registers waiter to be resumed on a job system thread once the counter reaches zero.
+     * If the counter is already done the waiter is scheduled immediately
+     */
+    void AddWaiter(JobCounterWaiter* waiter);
+
+private:
+    friend class JobSystem;
+
+    /** Marks the waiter list of a counter that has reached zero */
+    [[nodiscard]] static JobCounterWaiter* Closed()
+    {
+        static JobCounterWaiter s_closed;
+        return &s_closed;
+    }
+
+    /** Schedules every waiter in a list claimed from a counter */
+    static void ResumeWaiters(JobCounterWaiter* waiters);
+
+    std::atomic<uint32_t> m_value = 0;
+    std::atomic<JobCounterWaiter*> m_waiters = Closed();
+};
+
+/**
+ * Unit of work. Small callables are stored inline so scheduling never touches a heap
+ */
+struct alignas(kCacheLineSize) Job
+{
+    static constexpr size_t kPayloadSize = 48;
+
+    /** Runs the payload if run is set, then destroys it either way */
+    using EntryFn = void (*)(Job& job, bool run);
+
+    /** Null while the slot is free. Cleared by whichever thread runs the job, once it's done */
+    std::atomic<EntryFn> entry = nullptr;
+    JobCounter* counter = nullptr;
+    alignas(std::max_align_t) std::array<std::byte, kPayloadSize> payload = {};
+};
+
+class JobSystem
+{
+public:
+    static constexpr size_t kMaxWorkers = 64;
+
+    /** Jobs each thread may have in flight. Further jobs run inline on the scheduling thread */
+    static constexpr size_t kJobPoolSize = 4096;
+
+    static constexpr size_t kWorkerScratchpadSize = 64_KiB;
+
+    /**
+     * Spawns worker threads. The calling thread becomes thread 0 and may schedule and wait on jobs
+     * @param numWorkers Number of worker threads. Zero means one per core, minus the caller
+     */
+    static void Init(uint32_t numWorkers = 0)
+    {
+        SJ_ASSERT(!s_running.load(), "Double initialization of job system detected");
+
+        if(numWorkers == 0)
+            numWorkers = std::max(1u, std::thread::hardware_concurrency()) - 1;
+
+        numWorkers = std::min<uint32_t>(numWorkers, kMaxWorkers - 1);
+
+        s_numThreads = numWorkers + 1;
+        for(uint32_t i = 0; i < s_numThreads; i++)
+            s_threadStates.emplace_back(std::make_unique<ThreadState>());
+
+        s_threadIndex = 0;
+        s_running.store(true, std::memory_order_release);
+
+        for(uint32_t i = 1; i < s_numThreads; i++)
+            s_threadStates[i]->thread = std::thread(WorkerMain, i);
+
+        SJ_ENGINE_LOG_INFO("Job system started with {} worker threads", numWorkers);
+    }
+
+    /**
+     * Stops and joins all workers. Outstanding jobs are discarded without running, but their
+     * payloads are still destroyed
+     */
+    static void DeInit()
+    {
+        s_running.store(false, std::memory_order_release);
+        s_workGeneration.fetch_add(1, std::memory_order_release);
+        s_workGeneration.notify_all();
+
+        for(std::unique_ptr<ThreadState>& state : s_threadStates)
+        {
+            if(state->thread.joinable())
+                state->thread.join();
+        }
+
+        // Every thread is stopped, so anything still queued will never run
+        for(std::unique_ptr<ThreadState>& state : s_threadStates)
+        {
+            while(std::optional<Job*> job = state->deque.Steal())
+                Discard(**job);
+        }
+
+        s_threadStates.clear();
+        s_numThreads = 0;
+        s_threadIndex = kInvalidThreadIndex;
+    }
+
+    [[nodiscard]] static uint32_t GetNumThreads()
+    {
+        return s_numThreads;
+    }
+
+    /**
+     * @return Index of the calling thread within the job system, 0 being the thread that called
+     * Init
+     */
+    [[nodiscard]] static uint32_t GetThreadIndex()
+    {
+        return s_threadIndex;
+    }
+
+    /**
+     * Queues fn to run on any job system thread
+     * @param counter Optional counter incremented now and decremented once fn has run
+     */
+    template <class Fn>
+    static void Schedule(Fn&& fn, JobCounter* counter = nullptr)
+    {
+        using Callable = std::decay_t<Fn>;
+        static_assert(sizeof(Callable) <= Job::kPayloadSize, "Job capture is too large");
+        static_assert(alignof(Callable) <= alignof(std::max_align_t));
+
+        SJ_ASSERT(s_threadIndex != kInvalidThreadIndex,
+                  "Jobs may only be scheduled from job system threads");
+
+        Job* job = AllocateJob();
+        if(job == nullptr)
+        {
+            // Every slot is still queued or running. Run it here rather than overwrite one
+            Callable callable(std::forward<Fn>(fn));
+            callable();
+            return;
+        }
+
+        job->counter = counter;
+        new(job->payload.data()) Callable(std::forward<Fn>(fn));
+        job->entry.store(
+            [](Job& self, bool run) {
+                auto* callable = std::launder(reinterpret_cast<Callable*>(self.payload.data()));
+                if(run)
+                    (*callable)();
+
+                std::destroy_at(callable);
+            },
+            std::memory_order_relaxed);
+
+        Submit(job);
+    }
+
+    /**
+     * Runs other jobs on the calling thread until counter reaches zero
+     */
+    static void Wait(const JobCounter& counter)
+    {
+        while(!counter.IsDone())
+        {
+            if(!TryRunOneJob())
+                std::this_thread::yield();
+        }
+    }
+
+    /**
+     * Executes a single pending job on the calling thread if one can be found
+     * @return Whether a job was run
+     */
+    static bool TryRunOneJob()
+    {
+        Job* job = FindJob();
+        if(job == nullptr)
+            return false;
+
+        Execute(*job);
+        return true;
+    }
+
+private:
+    static constexpr uint32_t kInvalidThreadIndex = ~0u;
+
+    struct ThreadState
+    {
+        WorkStealingDeque<Job*, kJobPoolSize> deque;
+
+        /**
+         * Ring of job storage owned by this thread. Only the owner allocates, but any thread may
+         * free a slot by running its job, so a slot is reused only once its entry is cleared
+         */
+        std::array<Job, kJobPoolSize> jobPool = {};
+        size_t nextJob = 0;
+
+        std::thread thread;
+    };
+
+    /**
+     * @return The next slot in the ring, or nullptr if the job in it hasn't finished yet
+     */
+    static Job* AllocateJob()
+    {
+        ThreadState& state = *s_threadStates[s_threadIndex];
+        Job* job = &state.jobPool[state.nextJob++ & (kJobPoolSize - 1)];
+        if(job->entry.load(std::memory_order_acquire) != nullptr)
+            return nullptr;
+
+        return job;
+    }
+
+    static void Submit(Job* job)
+    {
+        if(job->counter && job->counter->m_value.fetch_add(1, std::memory_order_acq_rel) == 0)
+        {
+            // Reopen the waiter list. The job that last took the counter to zero may still be
+            // about to close it, so wait for that before reopening
+            JobCounterWaiter* expected = JobCounter::Closed();
+            while(!job->counter->m_waiters.compare_exchange_weak(expected,
+                                                                 nullptr,
+                                                                 std::memory_order_acq_rel,
+                                                                 std::memory_order_relaxed))
+            {
+                expected = JobCounter::Closed();
+                std::this_thread::yield();
+            }
+        }
+
+        ThreadState& state = *s_threadStates[s_threadIndex];
+        if(!state.deque.Push(job))
+        {
+            // Queue is saturated, run it here instead of dropping it
+            Execute(*job);
+            return;
+        }
+
+        s_workGeneration.fetch_add(1, std::memory_order_release);
+        s_workGeneration.notify_one();
+    }
+
+    static void Execute(Job& job)
+    {
+        JobCounter* counter = job.counter;
+        job.entry.load(std::memory_order_relaxed)(job, true);
+
+        // The owner may reuse the slot as soon as this is visible
+        job.entry.store(nullptr, std::memory_order_release);
+
+        if(counter && counter->m_value.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            // Claiming the waiters also marks the counter done, and is the last access to it
+            JobCounter::ResumeWaiters(
+                counter->m_waiters.exchange(JobCounter::Closed(), std::memory_order_acq_rel));
+        }
+    }
+
+    /**
+     * Releases a job that will never run. Its counter is left as is
+     */
+    static void Discard(Job& job)
+    {
+        job.entry.load(std::memory_order_relaxed)(job, false);
+        job.entry.store(nullptr, std::memory_order_relaxed);
+    }
+
+    static Job* FindJob()
+    {
+        if(s_threadIndex == kInvalidThreadIndex)
+            return nullptr;
+
+        if(std::optional<Job*> job = s_threadStates[s_threadIndex]->deque.Pop())
+            return *job;
+
+        // Steal from the other threads, starting from a different victim each time
+        const uint32_t start = s_stealSeed++;
+        for(uint32_t i = 0; i < s_numThreads; i++)
+        {
+            const uint32_t victim = (start + i) % s_numThreads;
+            if(victim == s_threadIndex)
+                continue;
+
+            if(std::optional<Job*> job = s_threadStates[victim]->deque.Steal())
+                return *job;
+        }
+
+        return nullptr;
+    }
+
+    static void WorkerMain(uint32_t threadIndex)
+    {
+        s_threadIndex = threadIndex;
+        s_stealSeed = threadIndex;
+
+        // The unmanaged resource is thread-safe, so workers can back their scratchpads with it
+        ThreadContext::Init(MemorySystem::GetUnmanagedMemoryResource(), kWorkerScratchpadSize);
+
+        while(s_running.load(std::memory_order_acquire))
+        {
+            const uint32_t generation = s_workGeneration.load(std::memory_order_acquire);
+
+            if(TryRunOneJob())
+                continue;
+
+            // Nothing to do, sleep until new work is published
+            s_workGeneration.wait(generation, std::memory_order_acquire);
+        }
+
+        ThreadContext::DeInit();
+    }
+
+    inline static std::atomic<bool> s_running = false;
+    inline static std::atomic<uint32_t> s_workGeneration = 0;
+
+    inline static uint32_t s_numThreads = 0;
+    inline static static_vector<std::unique_ptr<ThreadState>, kMaxWorkers> s_threadStates = {};
+
+    inline static thread_local uint32_t s_threadIndex = kInvalidThreadIndex;
+    inline static thread_local uint32_t s_stealSeed = 0;
+};
+
+void JobCounter::AddWaiter(JobCounterWaiter* waiter)
+{
+    JobCounterWaiter* head = m_waiters.load(std::memory_order_acquire);
+    do
+    {
+        if(head == Closed())
+        {
+            waiter->next = nullptr;
+            ResumeWaiters(waiter);
+            return;
+        }
+
+        waiter->next = head;
+    } while(!m_waiters.compare_exchange_weak(head,
+                                             waiter,
+                                             std::memory_order_release,
+                                             std::memory_order_acquire));
+}
+
+void JobCounter::ResumeWaiters(JobCounterWaiter* waiters)
+{
+    JobCounterWaiter* waiter = waiters;
+    while(waiter)
+    {
+        // Read next before scheduling, the waiter dies with its coroutine frame
+        JobCounterWaiter* next = waiter->next;
+        JobSystem::Schedule([handle = waiter->handle]() { handle.resume(); });
+        waiter = next;
+    }
+}
+} // namespace sj
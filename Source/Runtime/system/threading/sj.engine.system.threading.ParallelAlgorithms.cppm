@@ -0,0 +1,381 @@
+module;
+
+#include <ScrewjankStd/Assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+export module sj.engine.system.threading.ParallelAlgorithms;
+import sj.engine.system.threading.JobSystem;
+import sj.engine.system.threading.ThreadContext;
+import sj.std.containers.array;
+
+namespace sj::detail
+{
+/** Below this many elements per chunk, scheduling overhead outweighs the work */
+constexpr size_t kMinGrainSize = 256;
+
+/** Chunks handed out per thread. More chunks balance uneven work at the cost of overhead */
+constexpr size_t kChunksPerThread = 4;
+
+/**
+ * Fixed partition of [0, count) into equally sized chunks. Chunk boundaries are stable so passes
+ * that need to revisit the same chunks (scan, sort) see the same ranges
+ */
+struct ChunkLayout
+{
+    size_t count = 0;
+    size_t grainSize = 0;
+    size_t numChunks = 0;
+
+    [[nodiscard]] size_t Begin(size_t chunk) const
+    {
+        return chunk * grainSize;
+    }
+
+    [[nodiscard]] size_t End(size_t chunk) const
+    {
+        return std::min(count, (chunk + 1) * grainSize);
+    }
+};
+
+/**
+ * @param grainSize Elements per chunk. Zero picks a size from count and the number of job threads
+ */
+ChunkLayout MakeChunkLayout(size_t count, size_t grainSize)
+{
+    const size_t numThreads = std::max<size_t>(1, JobSystem::GetNumThreads());
+
+    if(grainSize == 0)
+        grainSize = std::max(kMinGrainSize, count / (numThreads * kChunksPerThread));
+
+    const size_t numChunks = count == 0 ? 0 : (count + grainSize - 1) / grainSize;
+    return {.count = count, .grainSize = grainSize, .numChunks = numChunks};
+}
+
+/** Parallel work is only possible from a job system thread with other threads to help */
+bool CanRunInParallel(size_t numChunks)
+{
+    return numChunks > 1 && JobSystem::GetNumThreads() > 1 &&
+           JobSystem::GetThreadIndex() < JobSystem::GetNumThreads();
+}
+
+/**
+ * Calls chunkFn(chunkIndex) for every chunk in layout.
+ * Helper jobs and the calling thread pull chunk indices from a shared counter, so a thread that
+ * lands on cheap chunks simply takes more of them. Blocks until every chunk has run
+ */
+template <class ChunkFn>
+void RunChunks(size_t numChunks, ChunkFn& chunkFn)
+{
+    if(!CanRunInParallel(numChunks))
+    {
+        for(size_t chunk = 0; chunk < numChunks; chunk++)
+            chunkFn(chunk);
+
+        return;
+    }
+
+    struct SharedState
+    {
+        ChunkFn* fn;
+        size_t numChunks;
+        std::atomic<size_t> nextChunk = 0;
+
+        void Drain()
+        {
+            size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+            while(chunk < numChunks)
+            {
+                (*fn)(chunk);
+                chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    SharedState state {.fn = &chunkFn, .numChunks = numChunks};
+
+    JobCounter counter;
+    const size_t numHelpers = std::min(numChunks, size_t(JobSystem::GetNumThreads())) - 1;
+    for(size_t i = 0; i < numHelpers; i++)
+        JobSystem::Schedule([&state]() { state.Drain(); }, &counter);
+
+    state.Drain();
+    JobSystem::Wait(counter);
+}
+
+/** Runs this short are insertion sorted before merging */
+constexpr size_t kInsertionSortRun = 32;
+
+/**
+ * Stable merge sort that merges through scratch instead of allocating like std::stable_sort.
+ * scratch must be at least as large as items. The sorted result ends up in items
+ */
+template <class T, class Compare>
+void StableSort(std::span<T> items, std::span<T> scratch, Compare& compare)
+{
+    const size_t count = items.size();
+
+    for(size_t begin = 0; begin < count; begin += kInsertionSortRun)
+    {
+        const size_t end = std::min(begin + kInsertionSortRun, count);
+        for(size_t i = begin + 1; i < end; i++)
+        {
+            T value = std::move(items[i]);
+
+            // Strict comparison keeps equal elements in their original order
+            size_t j = i;
+            for(; j > begin && compare(value, items[j - 1]); j--)
+                items[j] = std::move(items[j - 1]);
+
+            items[j] = std::move(value);
+        }
+    }
+
+    std::span<T> src = items;
+    std::span<T> dst = scratch.first(count);
+
+    for(size_t width = kInsertionSortRun; width < count; width *= 2)
+    {
+        for(size_t begin = 0; begin < count; begin += 2 * width)
+        {
+            const size_t mid = std::min(begin + width, count);
+            const size_t end = std::min(begin + 2 * width, count);
+
+            std::merge(std::make_move_iterator(src.begin() + begin),
+                       std::make_move_iterator(src.begin() + mid),
+                       std::make_move_iterator(src.begin() + mid),
+                       std::make_move_iterator(src.begin() + end),
+                       dst.begin() + begin,
+                       compare);
+        }
+
+        std::swap(src, dst);
+    }
+
+    if(src.data() != items.data())
+        std::move(src.begin(), src.end(), items.begin());
+}
+} // namespace sj::detail
+
+export namespace sj
+{
+/**
+ * Calls fn(index) for every index in [0, count), spread across the job system.
+ * Runs serially when called from outside the job system or when count is small
+ * @param grainSize Indices per job. Zero picks one adaptively
+ */
+template <class Fn>
+    requires std::invocable<Fn&, size_t>
+void ParallelFor(size_t count, Fn&& fn, size_t grainSize = 0)
+{
+    const detail::ChunkLayout layout = detail::MakeChunkLayout(count, grainSize);
+
+    auto chunkFn = [&layout, &fn](size_t chunk) {
+        const size_t end = layout.End(chunk);
+        for(size_t i = layout.Begin(chunk); i < end; i++)
+            fn(i);
+    };
+
+    detail::RunChunks(layout.numChunks, chunkFn);
+}
+
+/**
+ * Calls fn(element) for every element of items, spread across the job system
+ */
+template <class T, class Fn>
+    requires std::invocable<Fn&, T&>
+void ParallelFor(std::span<T> items, Fn&& fn, size_t grainSize = 0)
+{
+    ParallelFor(items.size(), [&items, &fn](size_t i) { fn(items[i]); }, grainSize);
+}
+
+/**
+ * Combines fn(index) for every index in [0, count) with combine.
+ * Chunks are reduced in parallel and their results combined in index order, so combine only needs
+ * to be associative
+ * @param identity Value that leaves any other unchanged when combined with it
+ */
+template <class T, class Fn, class Combine = std::plus<>>
+    requires std::invocable<Fn&, size_t> && std::invocable<Combine&, T, T>
+T ParallelReduce(size_t count,
+                 T identity,
+                 Fn&& fn,
+                 Combine&& combine = Combine(),
+                 size_t grainSize = 0)
+{
+    const detail::ChunkLayout layout = detail::MakeChunkLayout(count, grainSize);
+
+    scratchpad_scope scratchpad = ThreadContext::GetScratchpad();
+    dynamic_array<T, size_t> partials(layout.numChunks, identity, &scratchpad.get_allocator());
+
+    auto chunkFn = [&](size_t chunk) {
+        T accumulator = identity;
+        const size_t end = layout.End(chunk);
+        for(size_t i = layout.Begin(chunk); i < end; i++)
+            accumulator = combine(std::move(accumulator), fn(i));
+
+        partials[chunk] = std::move(accumulator);
+    };
+
+    detail::RunChunks(layout.numChunks, chunkFn);
+
+    T result = std::move(identity);
+    for(T& partial : partials)
+        result = combine(std::move(result), std::move(partial));
+
+    return result;
+}
+
+/**
+ * Combines every element of items with combine
+ */
+template <class T, class U, class Combine = std::plus<>>
+    requires std::invocable<Combine&, T, U&>
+T ParallelReduce(std::span<U> items,
+                 T identity,
+                 Combine&& combine = Combine(),
+                 size_t grainSize = 0)
+{
+    return ParallelReduce(
+        items.size(),
+        std::move(identity),
+        [&items](size_t i) -> U& { return items[i]; },
+        std::forward<Combine>(combine),
+        grainSize);
+}
+
+/**
+ * Inclusive prefix scan: out[i] = in[0] combine ... combine in[i].
+ * Two passes over the input: chunk totals are reduced in parallel, scanned serially, then each
+ * chunk is scanned in parallel starting from its predecessors' total. in and out may alias
+ */
+template <class T, class U, class Combine = std::plus<>>
+    requires std::invocable<Combine&, T, U&>
+void ParallelInclusiveScan(std::span<U> in,
+                           std::span<T> out,
+                           T identity,
+                           Combine&& combine = Combine(),
+                           size_t grainSize = 0)
+{
+    SJ_ASSERT(out.size() >= in.size(), "Scan output is smaller than its input");
+
+    const detail::ChunkLayout layout = detail::MakeChunkLayout(in.size(), grainSize);
+
+    if(!detail::CanRunInParallel(layout.numChunks))
+    {
+        T accumulator = identity;
+        for(size_t i = 0; i < in.size(); i++)
+        {
+            accumulator = combine(std::move(accumulator), in[i]);
+            out[i] = accumulator;
+        }
+
+        return;
+    }
+
+    scratchpad_scope scratchpad = ThreadContext::GetScratchpad();
+    dynamic_array<T, size_t> offsets(layout.numChunks, identity, &scratchpad.get_allocator());
+
+    auto reduceChunk = [&](size_t chunk) {
+        T accumulator = identity;
+        const size_t end = layout.End(chunk);
+        for(size_t i = layout.Begin(chunk); i < end; i++)
+            accumulator = combine(std::move(accumulator), in[i]);
+
+        offsets[chunk] = std::move(accumulator);
+    };
+    detail::RunChunks(layout.numChunks, reduceChunk);
+
+    // Turn chunk totals into the exclusive prefix each chunk starts from
+    T running = identity;
+    for(T& offset : offsets)
+    {
+        T total = std::move(offset);
+        offset = running;
+        running = combine(std::move(running), std::move(total));
+    }
+
+    auto scanChunk = [&](size_t chunk) {
+        T accumulator = offsets[chunk];
+        const size_t end = layout.End(chunk);
+        for(size_t i = layout.Begin(chunk); i < end; i++)
+        {
+            accumulator = combine(std::move(accumulator), in[i]);
+            out[i] = accumulator;
+        }
+    };
+    detail::RunChunks(layout.numChunks, scanChunk);
+}
+
+/**
+ * Stable merge sort across the job system. Chunks are sorted in parallel, then merged pairwise
+ * in parallel passes. Every pass merges through one temporary buffer taken from the calling
+ * thread's scratchpad, so nothing goes through the global operator new.
+ * T must be default constructible and movable
+ */
+template <class T, class Compare = std::less<>>
+    requires std::strict_weak_order<Compare&, T&, T&>
+void ParallelSort(std::span<T> items, Compare&& compare = Compare(), size_t grainSize = 0)
+{
+    const detail::ChunkLayout layout = detail::MakeChunkLayout(items.size(), grainSize);
+
+    scratchpad_scope scratchpad = ThreadContext::GetScratchpad();
+    dynamic_array<T, size_t> buffer(items.size(), &scratchpad.get_allocator());
+
+    std::span<T> src = items;
+    std::span<T> dst(buffer.data(), items.size());
+
+    if(!detail::CanRunInParallel(layout.numChunks))
+    {
+        detail::StableSort(src, dst, compare);
+        return;
+    }
+
+    // Chunks own disjoint ranges of the buffer, so they can sort through it concurrently
+    auto sortChunk = [&](size_t chunk) {
+        const size_t begin = layout.Begin(chunk);
+        const size_t size = layout.End(chunk) - begin;
+        detail::StableSort(src.subspan(begin, size), dst.subspan(begin, size), compare);
+    };
+    detail::RunChunks(layout.numChunks, sortChunk);
+
+    // Each pass merges runs of `width` chunks into runs of twice that
+    for(size_t width = 1; width < layout.numChunks; width *= 2)
+    {
+        const size_t numMerges = (layout.numChunks + 2 * width - 1) / (2 * width);
+
+        auto mergeRuns = [&](size_t merge) {
+            const size_t first = merge * 2 * width;
+            const size_t begin = layout.Begin(first);
+            const size_t mid =
+                first + width < layout.numChunks ? layout.Begin(first + width) : layout.count;
+            const size_t end = layout.End(std::min(first + 2 * width, layout.numChunks) - 1);
+
+            std::merge(std::make_move_iterator(src.begin() + begin),
+                       std::make_move_iterator(src.begin() + mid),
+                       std::make_move_iterator(src.begin() + mid),
+                       std::make_move_iterator(src.begin() + end),
+                       dst.begin() + begin,
+                       compare);
+        };
+        detail::RunChunks(numMerges, mergeRuns);
+
+        std::swap(src, dst);
+    }
+
+    // Odd number of passes leaves the result in the scratch buffer
+    if(src.data() != items.data())
+    {
+        ParallelFor(items.size(), [&](size_t i) { items[i] = std::move(src[i]); });
+    }
+}
+} // namespace sj
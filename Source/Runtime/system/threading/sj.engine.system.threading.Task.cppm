@@ -0,0 +1,612 @@
+module;
+
+#include <ScrewjankStd/Assert.hpp>
+#include <ScrewjankStd/Log.hpp>
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+export module sj.engine.system.threading.Task;
+import sj.engine.system.threading.JobSystem;
+import sj.engine.system.memory.MemorySystem;
+import sj.std.containers.mpsc_queue;
+
+export namespace sj
+{
+/**
+ * Thread-safe size-class pool for coroutine frames. Keeps frames off the global heap and recycles
+ * them between tasks. Frames larger than the biggest class go to the unmanaged resource
+ */
+class CoroutineFrameAllocator
+{
+public:
+    static constexpr std::array<size_t, 6> kSizeClasses = {128, 256, 512, 1024, 2048, 4096};
+    static constexpr size_t kBlocksPerSlab = 32;
+
+    [[nodiscard]] static void* Allocate(size_t size)
+    {
+        const size_t sizeClass = FindSizeClass(size);
+        if(sizeClass == kSizeClasses.size())
+            return MemorySystem::GetUnmanagedMemoryResource()->allocate(size);
+
+        Pool& pool = s_pools[sizeClass];
+        std::scoped_lock lock(pool.lock);
+
+        if(pool.freeList == nullptr)
+            AllocateSlab(pool, kSizeClasses[sizeClass]);
+
+        FreeBlock* block = pool.freeList;
+        pool.freeList = block->next;
+        return block;
+    }
+
+    static void Deallocate(void* memory, size_t size)
+    {
+        const size_t sizeClass = FindSizeClass(size);
+        if(sizeClass == kSizeClasses.size())
+        {
+            MemorySystem::GetUnmanagedMemoryResource()->deallocate(memory, size);
+            return;
+        }
+
+        Pool& pool = s_pools[sizeClass];
+        std::scoped_lock lock(pool.lock);
+
+        auto* block = new(memory) FreeBlock {.next = pool.freeList};
+        pool.freeList = block;
+    }
+
+    /**
+     * Returns every slab to the unmanaged resource. No frames may be alive
+     */
+    static void Release()
+    {
+        for(size_t i = 0; i < kSizeClasses.size(); i++)
+        {
+            Pool& pool = s_pools[i];
+            std::scoped_lock lock(pool.lock);
+
+            while(pool.slabs)
+            {
+                Slab* next = pool.slabs->next;
+                MemorySystem::GetUnmanagedMemoryResource()->deallocate(
+                    pool.slabs,
+                    SlabSize(kSizeClasses[i]));
+                pool.slabs = next;
+            }
+
+            pool.freeList = nullptr;
+        }
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next = nullptr;
+    };
+
+    struct alignas(std::max_align_t) Slab
+    {
+        Slab* next = nullptr;
+    };
+
+    struct Pool
+    {
+        std::mutex lock;
+        FreeBlock* freeList = nullptr;
+        Slab* slabs = nullptr;
+    };
+
+    static constexpr size_t FindSizeClass(size_t size)
+    {
+        for(size_t i = 0; i < kSizeClasses.size(); i++)
+        {
+            if(size <= kSizeClasses[i])
+                return i;
+        }
+
+        return kSizeClasses.size();
+    }
+
+    static constexpr size_t SlabSize(size_t blockSize)
+    {
+        return sizeof(Slab) + blockSize * kBlocksPerSlab;
+    }
+
+    static void AllocateSlab(Pool& pool, size_t blockSize)
+    {
+        void* memory = MemorySystem::GetUnmanagedMemoryResource()->allocate(SlabSize(blockSize));
+        pool.slabs = new(memory) Slab {.next = pool.slabs};
+
+        auto* blocks = reinterpret_cast<std::byte*>(pool.slabs + 1);
+        for(size_t i = 0; i < kBlocksPerSlab; i++)
+            pool.freeList = new(blocks + i * blockSize) FreeBlock {.next = pool.freeList};
+    }
+
+    inline static std::array<Pool, kSizeClasses.size()> s_pools = {};
+};
+
+template <class T = void>
+class task;
+
+namespace detail
+{
+    class task_promise_base
+    {
+    public:
+        struct final_awaiter
+        {
+            bool await_ready() noexcept
+            {
+                return false;
+            }
+
+            template <class Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+            {
+                // Symmetric transfer back to whoever awaited this task
+                std::coroutine_handle<> continuation = handle.promise().m_continuation;
+                return continuation ? continuation : std::noop_coroutine();
+            }
+
+            void await_resume() noexcept
+            {
+            }
+        };
+
+        // Tasks are lazy, they start when first awaited
+        std::suspend_always initial_suspend() noexcept
+        {
+            return {};
+        }
+
+        final_awaiter final_suspend() noexcept
+        {
+            return {};
+        }
+
+        void unhandled_exception() noexcept
+        {
+            SJ_ENGINE_LOG_FATAL("Unhandled exception escaped a task");
+            std::terminate();
+        }
+
+        static void* operator new(size_t size)
+        {
+            return CoroutineFrameAllocator::Allocate(size);
+        }
+
+        static void operator delete(void* memory, size_t size)
+        {
+            CoroutineFrameAllocator::Deallocate(memory, size);
+        }
+
+        std::coroutine_handle<> m_continuation;
+    };
+
+    template <class T>
+    class task_promise final : public task_promise_base
+    {
+    public:
+        task<T> get_return_object() noexcept;
+
+        template <class U>
+            requires std::convertible_to<U&&, T>
+        void return_value(U&& value)
+        {
+            m_value.emplace(std::forward<U>(value));
+        }
+
+        T take_result()
+        {
+            SJ_ASSERT(m_value.has_value(), "Task completed without a value");
+            return std::move(*m_value);
+        }
+
+    private:
+        std::optional<T> m_value;
+    };
+
+    template <>
+    class task_promise<void> final : public task_promise_base
+    {
+    public:
+        task<void> get_return_object() noexcept;
+
+        void return_void() noexcept
+        {
+        }
+
+        void take_result()
+        {
+        }
+    };
+} // namespace detail
+
+/**
+ * Lazily started coroutine producing a T. Awaiting a task starts it and resumes the awaiter when
+ * it completes. Frames come from the CoroutineFrameAllocator
+ */
+template <class T>
+class [[nodiscard]] task
+{
+public:
+    using promise_type = detail::task_promise<T>;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    task() = default;
+
+    explicit task(handle_type handle) : m_handle(handle)
+    {
+    }
+
+    task(const task& other) = delete;
+    task& operator=(const task& other) = delete;
+
+    task(task&& other) noexcept : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    task& operator=(task&& other) noexcept
+    {
+        if(this != &other)
+        {
+            if(m_handle)
+                m_handle.destroy();
+
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~task()
+    {
+        if(m_handle)
+            m_handle.destroy();
+    }
+
+    [[nodiscard]] bool is_ready() const
+    {
+        return !m_handle || m_handle.done();
+    }
+
+    auto operator co_await() && noexcept
+    {
+        struct awaiter
+        {
+            handle_type handle;
+
+            bool await_ready() const noexcept
+            {
+                return !handle || handle.done();
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                handle.promise().m_continuation = awaiting;
+                return handle;
+            }
+
+            T await_resume()
+            {
+                return handle.promise().take_result();
+            }
+        };
+
+        return awaiter {m_handle};
+    }
+
+private:
+    handle_type m_handle = nullptr;
+};
+
+namespace detail
+{
+    template <class T>
+    task<T> task_promise<T>::get_return_object() noexcept
+    {
+        return task<T> {std::coroutine_handle<task_promise<T>>::from_promise(*this)};
+    }
+
+    inline task<void> task_promise<void>::get_return_object() noexcept
+    {
+        return task<void> {std::coroutine_handle<task_promise<void>>::from_promise(*this)};
+    }
+
+    /**
+     * Eagerly started coroutine that frees itself on completion, used to root task chains
+     */
+    struct detached_task
+    {
+        struct promise_type
+        {
+            detached_task get_return_object() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void return_void() noexcept
+            {
+            }
+
+            void unhandled_exception() noexcept
+            {
+                SJ_ENGINE_LOG_FATAL("Unhandled exception escaped a task");
+                std::terminate();
+            }
+
+            static void* operator new(size_t size)
+            {
+                return CoroutineFrameAllocator::Allocate(size);
+            }
+
+            static void operator delete(void* memory, size_t size)
+            {
+                CoroutineFrameAllocator::Deallocate(memory, size);
+            }
+        };
+    };
+
+    inline detached_task run_detached(task<void> work, std::atomic<bool>* doneFlag)
+    {
+        co_await std::move(work);
+
+        if(doneFlag)
+            doneFlag->store(true, std::memory_order_release);
+    }
+} // namespace detail
+
+/**
+ * Coroutine suspended until the next frame. Lives in the awaiting coroutine's frame
+ */
+struct NextFrameWaiter : mpsc_queue_node<NextFrameWaiter>
+{
+    // User-declared so derived awaiters value-initialize through here, the node's constructor is
+    // only accessible to derived classes
+    NextFrameWaiter() = default;
+
+    std::coroutine_handle<> handle;
+    NextFrameWaiter* resumeNext = nullptr;
+};
+
+/**
+ * Owns the coroutines waiting to be resumed on the main thread at the start of the next frame
+ */
+class TaskScheduler
+{
+public:
+
+    /**
+     * Starts work on the calling thread. The task frees itself when it completes
+     */
+    static void Spawn(task<void>&& work)
+    {
+        detail::run_detached(std::move(work), nullptr);
+    }
+
+    /**
+     * Runs work to completion, executing jobs and next frame continuations while waiting.
+     * Intended for tools and tests, gameplay code should co_await instead
+     */
+    template <class T>
+    static T SyncWait(task<T>&& work)
+    {
+        std::atomic<bool> done = false;
+        std::optional<std::conditional_t<std::is_void_v<T>, std::monostate, T>> result;
+
+        auto wrapper = [](task<T> inner, auto& out) -> task<void> {
+            if constexpr(std::is_void_v<T>)
+            {
+                co_await std::move(inner);
+                out.emplace();
+            }
+            else
+            {
+                out.emplace(co_await std::move(inner));
+            }
+        };
+
+        detail::run_detached(wrapper(std::move(work), result), &done);
+
+        while(!done.load(std::memory_order_acquire))
+        {
+            if(JobSystem::GetThreadIndex() == 0)
+                ResumeNextFrameWaiters();
+
+            if(!JobSystem::TryRunOneJob())
+                std::this_thread::yield();
+        }
+
+        if constexpr(!std::is_void_v<T>)
+            return std::move(*result);
+    }
+
+    /**
+     * Any thread. Queues waiter to be resumed by the next call to ResumeNextFrameWaiters
+     */
+    static void AddNextFrameWaiter(NextFrameWaiter* waiter)
+    {
+        s_nextFrameWaiters.push(waiter);
+    }
+
+    /**
+     * Main thread only. Resumes everything that awaited NextFrame before this call. Coroutines that
+     * await NextFrame again while resuming are deferred to the following frame
+     */
+    static void ResumeNextFrameWaiters()
+    {
+        // Detach the current waiters first so re-queued coroutines land in the next frame
+        NextFrameWaiter* resumeHead = nullptr;
+        NextFrameWaiter** resumeTail = &resumeHead;
+        while(NextFrameWaiter* waiter = s_nextFrameWaiters.try_pop())
+        {
+            *resumeTail = waiter;
+            resumeTail = &waiter->resumeNext;
+        }
+        *resumeTail = nullptr;
+
+        while(resumeHead)
+        {
+            // Read next before resuming, the waiter dies with its coroutine frame
+            NextFrameWaiter* next = resumeHead->resumeNext;
+            resumeHead->handle.resume();
+            resumeHead = next;
+        }
+    }
+
+private:
+    inline static mpsc_queue<NextFrameWaiter> s_nextFrameWaiters;
+};
+
+/**
+ * co_await NextFrame{} suspends until the start of the next frame and resumes on the main thread.
+ * Use it to hop back from worker threads before touching main thread only systems
+ */
+struct NextFrame : NextFrameWaiter
+{
+    NextFrame() = default;
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> awaiter)
+    {
+        handle = awaiter;
+        TaskScheduler::AddNextFrameWaiter(this);
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+};
+
+/**
+ * co_await ResumeOnWorker{} continues the coroutine as a job on the job system
+ */
+struct ResumeOnWorker
+{
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const
+    {
+        JobSystem::Schedule([handle]() { handle.resume(); });
+    }
+
+    void await_resume() const noexcept
+    {
+    }
+};
+
+/**
+ * Suspends until counter reaches zero. Resumes on a job system thread
+ */
+inline auto operator co_await(JobCounter& counter) noexcept
+{
+    struct awaiter
+    {
+        JobCounter& counter;
+        JobCounterWaiter waiter = {};
+
+        bool await_ready() const noexcept
+        {
+            return counter.IsDone();
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            waiter.handle = handle;
+            counter.AddWaiter(&waiter);
+        }
+
+        void await_resume() const noexcept
+        {
+        }
+    };
+
+    return awaiter {counter};
+}
+
+/**
+ * Reads a whole file on a worker thread. Resumes on that worker with the file contents, which are
+ * empty if the file could not be read
+ * @param resource Backing memory for the result, must be thread-safe
+ */
+inline auto ReadFileAsync(std::string path, std::pmr::memory_resource* resource = nullptr)
+{
+    struct awaiter
+    {
+        std::string path;
+        std::pmr::vector<std::byte> result;
+
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            JobSystem::Schedule([this, handle]() {
+                ReadFile();
+                handle.resume();
+            });
+        }
+
+        std::pmr::vector<std::byte> await_resume()
+        {
+            return std::move(result);
+        }
+
+        void ReadFile()
+        {
+            std::error_code error;
+            const uintmax_t fileSize = std::filesystem::file_size(path, error);
+            std::ifstream file(path, std::ios::binary);
+            if(error || !file)
+            {
+                SJ_ENGINE_LOG_ERROR("Failed to read file {}", path);
+                return;
+            }
+
+            result.resize(fileSize);
+            file.read(reinterpret_cast<char*>(result.data()),
+                      static_cast<std::streamsize>(fileSize));
+        }
+    };
+
+    if(resource == nullptr)
+        resource = MemorySystem::GetUnmanagedMemoryResource();
+
+    return awaiter {.path = std::move(path), .result = std::pmr::vector<std::byte>(resource)};
+}
+} // namespace sj
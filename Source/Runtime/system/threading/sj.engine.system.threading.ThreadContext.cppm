@@ -1,6 +1,7 @@
 module;
 
 #include <cstddef>
+#include <memory_resource>
 
 export module sj.engine.system.threading.ThreadContext;
 export import sj.std.memory.scratchpad_scope;
@@ -11,16 +12,24 @@ export namespace sj
     class ThreadContext
     {
     public:
-        static void Init(sj::memory_resource* backing_resource, size_t scratchpadSize)
+        /**
+         * Allocates this thread's scratchpad from backing_resource.
+         * When the scratchpad is exhausted it chains extra blocks from backing_resource, which
+         * are released once the scratchpad_scope that needed them unwinds
+         */
+        static void Init(std::pmr::memory_resource* backing_resource, size_t scratchpadSize)
         {
             s_scratchpadParentResource = backing_resource;
             void* memory = backing_resource->allocate(scratchpadSize);
             s_scratchpadAllocator.init(scratchpadSize, reinterpret_cast<std::byte*>(memory));
+            s_scratchpadAllocator.set_overflow_resource(backing_resource);
         }
 
         static void DeInit()
         {
-            s_scratchpadParentResource->deallocate(s_scratchpadAllocator.data(), s_scratchpadAllocator.buffer_size());
+            s_scratchpadAllocator.reset();
+            s_scratchpadParentResource->deallocate(s_scratchpadAllocator.data(),
+                                                   s_scratchpadAllocator.buffer_size());
         }
 
         [[nodiscard]] static scratchpad_scope GetScratchpad()
@@ -28,8 +37,16 @@ export namespace sj
             return scratchpad_scope(s_scratchpadAllocator);
         }
 
+        /**
+         * @return Peak bytes used by this thread's scratchpad, including overflow blocks
+         */
+        [[nodiscard]] static size_t GetScratchpadHighWaterMark()
+        {
+            return s_scratchpadAllocator.get_high_water_mark();
+        }
+
     private:
-        static inline thread_local sj::memory_resource* s_scratchpadParentResource = nullptr;
+        static inline thread_local std::pmr::memory_resource* s_scratchpadParentResource = nullptr;
         static inline thread_local linear_allocator s_scratchpadAllocator = {};
     };
 }; // namespace sj
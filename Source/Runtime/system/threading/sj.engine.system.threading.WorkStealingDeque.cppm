@@ -0,0 +1,141 @@
+module;
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+export module sj.engine.system.threading.WorkStealingDeque;
+import sj.std.memory.utils;
+
+export namespace sj
+{
+/**
+ * Fixed capacity Chase-Lev work-stealing deque.
+ * The owning thread pushes and pops at the bottom, any other thread may steal from the top.
+ * @tparam T Trivially copyable element, typically a pointer
+ * @tparam kCapacity Maximum number of elements. Must be a power of two
+ */
+template <class T, size_t kCapacity>
+class WorkStealingDeque
+{
+    static_assert((kCapacity & (kCapacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+    WorkStealingDeque() = default;
+    WorkStealingDeque(const WorkStealingDeque& other) = delete;
+    WorkStealingDeque(WorkStealingDeque&& other) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque& other) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&& other) = delete;
+
+    /**
+     * Owner only. Adds an element to the bottom of the deque
+     * @return False if the deque is full
+     */
+    bool Push(T value)
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_acquire);
+
+        if(bottom - top >= static_cast<int64_t>(kCapacity))
+            return false;
+
+        m_buffer[bottom & kMask].store(value, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    /**
+     * Owner only. Removes the most recently pushed element
+     */
+    std::optional<T> Pop()
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+        m_bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_top.load(std::memory_order_relaxed);
+
+        if(top > bottom)
+        {
+            // Deque was empty
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        std::optional<T> value = m_buffer[bottom & kMask].load(std::memory_order_relaxed);
+        if(top == bottom)
+        {
+            // Last element, race thieves for it
+            if(!m_top.compare_exchange_strong(top,
+                                              top + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+            {
+                value = std::nullopt;
+            }
+
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return value;
+    }
+
+    /**
+     * Any thread. Removes the oldest element
+     */
+    std::optional<T> Steal()
+    {
+        int64_t top = m_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+        if(top >= bottom)
+            return std::nullopt;
+
+        T value = m_buffer[top & kMask].load(std::memory_order_relaxed);
+        if(!m_top.compare_exchange_strong(top,
+                                          top + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+        {
+            // Lost the race with the owner or another thief
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+    /**
+     * @return Approximate number of elements. Exact only when called by the owner while no
+     * thieves are active
+     */
+    [[nodiscard]] size_t Size() const
+    {
+        const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+        const int64_t top = m_top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    [[nodiscard]] bool Empty() const
+    {
+        return Size() == 0;
+    }
+
+    static constexpr size_t Capacity()
+    {
+        return kCapacity;
+    }
+
+private:
+    static constexpr int64_t kMask = static_cast<int64_t>(kCapacity) - 1;
+
+    // Thieves hammer top while the owner works at the bottom, keep them on separate lines
+    alignas(kCacheLineSize) std::atomic<int64_t> m_top = 0;
+    alignas(kCacheLineSize) std::atomic<int64_t> m_bottom = 0;
+    alignas(kCacheLineSize) std::atomic<T> m_buffer[kCapacity] = {};
+};
+} // namespace sj
@@ -1,4 +1,8 @@
 module;
 
 export module sj.engine.system.threading;
-export import sj.engine.system.threading.ThreadContext;
\ No newline at end of file
+export import sj.engine.system.threading.JobSystem;
+export import sj.engine.system.threading.ParallelAlgorithms;
+export import sj.engine.system.threading.Task;
+export import sj.engine.system.threading.ThreadContext;
+export import sj.engine.system.threading.WorkStealingDeque;
\ No newline at end of file
@@ -0,0 +1,586 @@
+module;
+
+// STD Headers
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define SJ_BITSET_AVX2
+#endif
+
+// Screwjank Headers
+#include <ScrewjankStd/Assert.hpp>
+
+export module sj.std.containers.bitset;
+
+namespace sj::bitset_detail
+{
+using word_t = uint64_t;
+constexpr size_t kWordBits = 64;
+
+constexpr size_t WordsFor(size_t bits)
+{
+    return (bits + kWordBits - 1) / kWordBits;
+}
+
+/** Bits of the final word that are inside the set. All ones when the set fills the word */
+constexpr word_t TailMask(size_t bits)
+{
+    const size_t used = bits % kWordBits;
+    return used == 0 ? ~word_t(0) : (word_t(1) << used) - 1;
+}
+
+enum class WordOp
+{
+    kAnd,
+    kOr,
+    kXor,
+    kAndNot
+};
+
+template <WordOp tOp>
+constexpr word_t ApplyWord(word_t lhs, word_t rhs)
+{
+    if constexpr(tOp == WordOp::kAnd)
+        return lhs & rhs;
+    else if constexpr(tOp == WordOp::kOr)
+        return lhs | rhs;
+    else if constexpr(tOp == WordOp::kXor)
+        return lhs ^ rhs;
+    else
+        return lhs & ~rhs;
+}
+
+/** dst[i] = dst[i] op src[i] for count words. Long sets go 256 bits at a time where available */
+template <WordOp tOp>
+constexpr void ApplyWords(word_t* dst, const word_t* src, size_t count)
+{
+    size_t i = 0;
+
+#ifdef SJ_BITSET_AVX2
+    if(!std::is_constant_evaluated())
+    {
+        for(; i + 4 <= count; i += 4)
+        {
+            const __m256i lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+            const __m256i rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+
+            __m256i result;
+            if constexpr(tOp == WordOp::kAnd)
+                result = _mm256_and_si256(lhs, rhs);
+            else if constexpr(tOp == WordOp::kOr)
+                result = _mm256_or_si256(lhs, rhs);
+            else if constexpr(tOp == WordOp::kXor)
+                result = _mm256_xor_si256(lhs, rhs);
+            else
+                result = _mm256_andnot_si256(rhs, lhs);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), result);
+        }
+    }
+#endif
+
+    for(; i < count; i++)
+        dst[i] = ApplyWord<tOp>(dst[i], src[i]);
+}
+
+/** True if every bit set in subset is also set in superset */
+constexpr bool WordsInclude(const word_t* superset, const word_t* subset, size_t count)
+{
+    size_t i = 0;
+
+#ifdef SJ_BITSET_AVX2
+    if(!std::is_constant_evaluated())
+    {
+        for(; i + 4 <= count; i += 4)
+        {
+            const __m256i super = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(superset + i));
+            const __m256i sub = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(subset + i));
+
+            // testc: (~super & sub) == 0
+            if(!_mm256_testc_si256(super, sub))
+                return false;
+        }
+    }
+#endif
+
+    for(; i < count; i++)
+    {
+        if((superset[i] & subset[i]) != subset[i])
+            return false;
+    }
+
+    return true;
+}
+
+/** True if any bit is set in both lhs and rhs */
+constexpr bool WordsIntersect(const word_t* lhs, const word_t* rhs, size_t count)
+{
+    size_t i = 0;
+
+#ifdef SJ_BITSET_AVX2
+    if(!std::is_constant_evaluated())
+    {
+        for(; i + 4 <= count; i += 4)
+        {
+            const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+            const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+
+            // testz: (a & b) == 0
+            if(!_mm256_testz_si256(a, b))
+                return true;
+        }
+    }
+#endif
+
+    for(; i < count; i++)
+    {
+        if((lhs[i] & rhs[i]) != 0)
+            return true;
+    }
+
+    return false;
+}
+} // namespace sj::bitset_detail
+
+export namespace sj
+{
+    /**
+     * Bits packed into 64 bit words, sized at runtime.
+     * Bits past size() in the final word are always zero so whole-word operations never see them
+     */
+    template <class Allocator = std::pmr::polymorphic_allocator<uint64_t>>
+    class dynamic_bitset_storage
+    {
+        using word_t = bitset_detail::word_t;
+        using allocator_traits = std::allocator_traits<Allocator>;
+
+    public:
+        using allocator_type = Allocator;
+
+        dynamic_bitset_storage() = default;
+
+        dynamic_bitset_storage(const Allocator& alloc) noexcept : m_allocator(alloc)
+        {
+        }
+
+        dynamic_bitset_storage(size_t bits, bool value = false, const Allocator& alloc = Allocator())
+            : m_allocator(alloc)
+        {
+            resize(bits, value);
+        }
+
+        dynamic_bitset_storage(const dynamic_bitset_storage& other)
+            : m_allocator(allocator_traits::select_on_container_copy_construction(other.m_allocator))
+        {
+            *this = other;
+        }
+
+        dynamic_bitset_storage(dynamic_bitset_storage&& other) noexcept
+            : m_allocator(other.m_allocator),
+              m_words(std::exchange(other.m_words, nullptr)),
+              m_numWords(std::exchange(other.m_numWords, 0)),
+              m_numBits(std::exchange(other.m_numBits, 0))
+        {
+        }
+
+        ~dynamic_bitset_storage()
+        {
+            if(m_words)
+                allocator_traits::deallocate(m_allocator, m_words, m_numWords);
+        }
+
+        dynamic_bitset_storage& operator=(const dynamic_bitset_storage& other)
+        {
+            if(this == &other)
+                return *this;
+
+            resize(other.m_numBits);
+            std::copy_n(other.m_words, word_count(), m_words);
+
+            return *this;
+        }
+
+        dynamic_bitset_storage& operator=(dynamic_bitset_storage&& other) noexcept
+        {
+            if(this == &other)
+                return *this;
+
+            if(m_allocator != other.m_allocator)
+                return *this = static_cast<const dynamic_bitset_storage&>(other);
+
+            if(m_words)
+                allocator_traits::deallocate(m_allocator, m_words, m_numWords);
+
+            m_words = std::exchange(other.m_words, nullptr);
+            m_numWords = std::exchange(other.m_numWords, 0);
+            m_numBits = std::exchange(other.m_numBits, 0);
+
+            return *this;
+        }
+
+        /**
+         * Changes the number of bits in the set
+         * @param value State of any bits added to the end
+         */
+        void resize(size_t bits, bool value = false)
+        {
+            const size_t oldBits = m_numBits;
+            const size_t neededWords = bitset_detail::WordsFor(bits);
+
+            if(neededWords > m_numWords)
+            {
+                word_t* newWords = allocator_traits::allocate(m_allocator, neededWords);
+                std::copy_n(m_words, bitset_detail::WordsFor(oldBits), newWords);
+                std::fill(newWords + bitset_detail::WordsFor(oldBits), newWords + neededWords, 0);
+
+                if(m_words)
+                    allocator_traits::deallocate(m_allocator, m_words, m_numWords);
+
+                m_words = newWords;
+                m_numWords = neededWords;
+            }
+
+            m_numBits = bits;
+
+            if(bits > oldBits && value)
+            {
+                // Fill the rest of the old final word, then whole words
+                const size_t firstWord = oldBits / bitset_detail::kWordBits;
+                if(oldBits % bitset_detail::kWordBits != 0)
+                    m_words[firstWord] |= ~bitset_detail::TailMask(oldBits);
+
+                const size_t firstWholeWord = bitset_detail::WordsFor(oldBits);
+                std::fill(m_words + firstWholeWord, m_words + word_count(), ~word_t(0));
+            }
+            else if(bits < oldBits)
+            {
+                // Dropped words must read as zero if the set grows again
+                std::fill(m_words + word_count(), m_words + bitset_detail::WordsFor(oldBits), 0);
+            }
+
+            if(word_count() > 0)
+                m_words[word_count() - 1] &= bitset_detail::TailMask(bits);
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_numBits;
+        }
+
+        [[nodiscard]] size_t word_count() const noexcept
+        {
+            return bitset_detail::WordsFor(m_numBits);
+        }
+
+        word_t* words() noexcept
+        {
+            return m_words;
+        }
+
+        const word_t* words() const noexcept
+        {
+            return m_words;
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return m_allocator;
+        }
+
+    private:
+        allocator_type m_allocator = {};
+        word_t* m_words = nullptr;
+        size_t m_numWords = 0;
+        size_t m_numBits = 0;
+    };
+
+    /**
+     * N bits packed into 64 bit words stored inline
+     */
+    template <size_t N>
+    class static_bitset_storage
+    {
+        using word_t = bitset_detail::word_t;
+
+    public:
+        constexpr static_bitset_storage() = default;
+
+        [[nodiscard]] constexpr size_t size() const noexcept
+        {
+            return N;
+        }
+
+        [[nodiscard]] constexpr size_t word_count() const noexcept
+        {
+            return m_words.size();
+        }
+
+        constexpr word_t* words() noexcept
+        {
+            return m_words.data();
+        }
+
+        constexpr const word_t* words() const noexcept
+        {
+            return m_words.data();
+        }
+
+    private:
+        std::array<word_t, bitset_detail::WordsFor(N)> m_words = {};
+    };
+
+    /**
+     * Set of bits with word-parallel set operations.
+     * Binary operations require both sets to be the same size
+     */
+    template <class Storage>
+    class bitset_interface : public Storage
+    {
+        using word_t = bitset_detail::word_t;
+        static constexpr size_t kWordBits = bitset_detail::kWordBits;
+
+    public:
+        /** Returned by searches that find nothing */
+        static constexpr size_t npos = ~size_t(0);
+
+        using Storage::Storage;
+
+        [[nodiscard]] constexpr bool test(size_t bit) const noexcept
+        {
+            SJ_ASSERT(bit < this->size(), "Bit index out of bounds");
+            return (this->words()[bit / kWordBits] >> (bit % kWordBits)) & 1;
+        }
+
+        [[nodiscard]] constexpr bool operator[](size_t bit) const noexcept
+        {
+            return test(bit);
+        }
+
+        constexpr bitset_interface& set(size_t bit, bool value = true) noexcept
+        {
+            SJ_ASSERT(bit < this->size(), "Bit index out of bounds");
+
+            const word_t mask = word_t(1) << (bit % kWordBits);
+            word_t& word = this->words()[bit / kWordBits];
+            word = value ? (word | mask) : (word & ~mask);
+
+            return *this;
+        }
+
+        constexpr bitset_interface& reset(size_t bit) noexcept
+        {
+            return set(bit, false);
+        }
+
+        constexpr bitset_interface& flip(size_t bit) noexcept
+        {
+            SJ_ASSERT(bit < this->size(), "Bit index out of bounds");
+            this->words()[bit / kWordBits] ^= word_t(1) << (bit % kWordBits);
+            return *this;
+        }
+
+        /** Sets every bit */
+        constexpr bitset_interface& set() noexcept
+        {
+            std::fill_n(this->words(), this->word_count(), ~word_t(0));
+            clear_unused_bits();
+            return *this;
+        }
+
+        /** Clears every bit */
+        constexpr bitset_interface& reset() noexcept
+        {
+            std::fill_n(this->words(), this->word_count(), 0);
+            return *this;
+        }
+
+        /** Flips every bit */
+        constexpr bitset_interface& flip() noexcept
+        {
+            for(size_t i = 0; i < this->word_count(); i++)
+                this->words()[i] = ~this->words()[i];
+
+            clear_unused_bits();
+            return *this;
+        }
+
+        /** Number of set bits */
+        [[nodiscard]] constexpr size_t count() const noexcept
+        {
+            size_t total = 0;
+            for(size_t i = 0; i < this->word_count(); i++)
+                total += std::popcount(this->words()[i]);
+
+            return total;
+        }
+
+        [[nodiscard]] constexpr bool any() const noexcept
+        {
+            return std::any_of(this->words(),
+                               this->words() + this->word_count(),
+                               [](word_t word) { return word != 0; });
+        }
+
+        [[nodiscard]] constexpr bool none() const noexcept
+        {
+            return !any();
+        }
+
+        [[nodiscard]] constexpr bool all() const noexcept
+        {
+            return count() == this->size();
+        }
+
+        constexpr bitset_interface& operator&=(const bitset_interface& other) noexcept
+        {
+            return apply<bitset_detail::WordOp::kAnd>(other);
+        }
+
+        constexpr bitset_interface& operator|=(const bitset_interface& other) noexcept
+        {
+            return apply<bitset_detail::WordOp::kOr>(other);
+        }
+
+        constexpr bitset_interface& operator^=(const bitset_interface& other) noexcept
+        {
+            return apply<bitset_detail::WordOp::kXor>(other);
+        }
+
+        /** Clears every bit that is set in other */
+        constexpr bitset_interface& and_not(const bitset_interface& other) noexcept
+        {
+            return apply<bitset_detail::WordOp::kAndNot>(other);
+        }
+
+        /** True if every bit set in other is also set here. Matches entity signatures to queries */
+        [[nodiscard]] constexpr bool includes(const bitset_interface& other) const noexcept
+        {
+            SJ_ASSERT(this->size() == other.size(), "Bitset sizes do not match");
+            return bitset_detail::WordsInclude(this->words(), other.words(), this->word_count());
+        }
+
+        /** True if any bit is set in both sets */
+        [[nodiscard]] constexpr bool intersects(const bitset_interface& other) const noexcept
+        {
+            SJ_ASSERT(this->size() == other.size(), "Bitset sizes do not match");
+            return bitset_detail::WordsIntersect(this->words(), other.words(), this->word_count());
+        }
+
+        /** @return Index of the lowest set bit, or npos */
+        [[nodiscard]] constexpr size_t find_first() const noexcept
+        {
+            return find_next(0);
+        }
+
+        /** @return Index of the lowest set bit at or after bit, or npos */
+        [[nodiscard]] constexpr size_t find_next(size_t bit) const noexcept
+        {
+            if(bit >= this->size())
+                return npos;
+
+            size_t wordIndex = bit / kWordBits;
+            word_t word = this->words()[wordIndex] & (~word_t(0) << (bit % kWordBits));
+
+            while(word == 0)
+            {
+                wordIndex++;
+                if(wordIndex == this->word_count())
+                    return npos;
+
+                word = this->words()[wordIndex];
+            }
+
+            return wordIndex * kWordBits + std::countr_zero(word);
+        }
+
+        /** @return Index of the lowest clear bit, or npos. Useful for free-slot tracking */
+        [[nodiscard]] constexpr size_t find_first_unset() const noexcept
+        {
+            for(size_t i = 0; i < this->word_count(); i++)
+            {
+                const word_t word = this->words()[i];
+                if(word != ~word_t(0))
+                {
+                    const size_t bit = i * kWordBits + std::countr_one(word);
+                    return bit < this->size() ? bit : npos;
+                }
+            }
+
+            return npos;
+        }
+
+        /**
+         * Calls fn(index) for every set bit in ascending order.
+         * Skips clear bits a word at a time, so sparse sets cost little more than their word count
+         */
+        template <class Fn>
+        constexpr void for_each_set_bit(Fn&& fn) const
+        {
+            for(size_t i = 0; i < this->word_count(); i++)
+            {
+                word_t word = this->words()[i];
+                while(word != 0)
+                {
+                    fn(i * kWordBits + std::countr_zero(word));
+                    word &= word - 1;
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr bool operator==(const bitset_interface& other) const noexcept
+        {
+            return this->size() == other.size() &&
+                   std::equal(this->words(), this->words() + this->word_count(), other.words());
+        }
+
+    private:
+        template <bitset_detail::WordOp tOp>
+        constexpr bitset_interface& apply(const bitset_interface& other) noexcept
+        {
+            SJ_ASSERT(this->size() == other.size(), "Bitset sizes do not match");
+            bitset_detail::ApplyWords<tOp>(this->words(), other.words(), this->word_count());
+            return *this;
+        }
+
+        constexpr void clear_unused_bits() noexcept
+        {
+            if(this->word_count() > 0)
+                this->words()[this->word_count() - 1] &= bitset_detail::TailMask(this->size());
+        }
+    };
+
+    template <class Storage>
+    constexpr bitset_interface<Storage> operator&(bitset_interface<Storage> lhs,
+                                                  const bitset_interface<Storage>& rhs)
+    {
+        return lhs &= rhs;
+    }
+
+    template <class Storage>
+    constexpr bitset_interface<Storage> operator|(bitset_interface<Storage> lhs,
+                                                  const bitset_interface<Storage>& rhs)
+    {
+        return lhs |= rhs;
+    }
+
+    template <class Storage>
+    constexpr bitset_interface<Storage> operator^(bitset_interface<Storage> lhs,
+                                                  const bitset_interface<Storage>& rhs)
+    {
+        return lhs ^= rhs;
+    }
+
+    using dynamic_bitset = bitset_interface<dynamic_bitset_storage<>>;
+
+    template <size_t N>
+    using static_bitset = bitset_interface<static_bitset_storage<N>>;
+} // namespace sj
@@ -1,10 +1,16 @@
 export module sj.std.containers;
 export import sj.std.containers.any;
 export import sj.std.containers.array;
+export import sj.std.containers.bitset;
+export import sj.std.containers.hash_map;
 export import sj.std.containers.map;
+export import sj.std.containers.mpmc_queue;
+export import sj.std.containers.mpsc_queue;
 export import sj.std.containers.vector;
 export import sj.std.containers.set;
+export import sj.std.containers.soa_vector;
 export import sj.std.containers.sparse_set;
+export import sj.std.containers.spsc_queue;
 export import sj.std.containers.stack;
 export import sj.std.containers.static_string;
 export import sj.std.containers.type_list;
@@ -0,0 +1,1115 @@
+module;
+
+// STD Headers
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define SJ_HASH_MAP_SSE2
+#endif
+
+// Screwjank Headers
+#include <ScrewjankStd/Assert.hpp>
+
+export module sj.std.containers.hash_map;
+import sj.std.string_hash;
+
+namespace sj::hash_map_detail
+{
+/**
+ * Control bytes track the state of each slot. Full slots store the low 7 bits of the key's hash,
+ * so most mismatches are rejected without touching the slot itself
+ */
+using ctrl_t = int8_t;
+constexpr ctrl_t kEmpty = -128;
+constexpr ctrl_t kDeleted = -2;
+
+constexpr size_t kGroupWidth = 16;
+
+constexpr bool IsFull(ctrl_t ctrl)
+{
+    return ctrl >= 0;
+}
+
+/** Bit i is set if the i'th control byte of a group matched */
+class BitMask
+{
+public:
+    explicit BitMask(uint32_t mask) : m_mask(mask)
+    {
+    }
+
+    explicit operator bool() const
+    {
+        return m_mask != 0;
+    }
+
+    [[nodiscard]] uint32_t LowestBit() const
+    {
+        return static_cast<uint32_t>(std::countr_zero(m_mask));
+    }
+
+    [[nodiscard]] uint32_t TrailingZeros() const
+    {
+        return static_cast<uint32_t>(std::countr_zero(m_mask));
+    }
+
+    [[nodiscard]] uint32_t LeadingZeros() const
+    {
+        constexpr uint32_t kShift = 32 - kGroupWidth;
+        return static_cast<uint32_t>(std::countl_zero(m_mask << kShift));
+    }
+
+    BitMask& operator++()
+    {
+        m_mask &= m_mask - 1;
+        return *this;
+    }
+
+    uint32_t operator*() const
+    {
+        return LowestBit();
+    }
+
+    BitMask begin() const
+    {
+        return *this;
+    }
+
+    BitMask end() const
+    {
+        return BitMask(0);
+    }
+
+    bool operator==(const BitMask& other) const = default;
+
+private:
+    uint32_t m_mask;
+};
+
+/** kGroupWidth control bytes, matched against in parallel */
+class Group
+{
+public:
+    explicit Group(const ctrl_t* ctrl)
+    {
+#ifdef SJ_HASH_MAP_SSE2
+        m_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+#else
+        std::memcpy(m_ctrl, ctrl, kGroupWidth);
+#endif
+    }
+
+    [[nodiscard]] BitMask Match(ctrl_t hash) const
+    {
+#ifdef SJ_HASH_MAP_SSE2
+        const __m128i match = _mm_set1_epi8(static_cast<char>(hash));
+        return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(match, m_ctrl))));
+#else
+        uint32_t mask = 0;
+        for(uint32_t i = 0; i < kGroupWidth; i++)
+            mask |= uint32_t(m_ctrl[i] == hash) << i;
+        return BitMask(mask);
+#endif
+    }
+
+    [[nodiscard]] BitMask MatchEmpty() const
+    {
+        return Match(kEmpty);
+    }
+
+    /** Empty and deleted are the only states with the sign bit set */
+    [[nodiscard]] BitMask MatchEmptyOrDeleted() const
+    {
+#ifdef SJ_HASH_MAP_SSE2
+        return BitMask(static_cast<uint32_t>(_mm_movemask_epi8(m_ctrl)));
+#else
+        uint32_t mask = 0;
+        for(uint32_t i = 0; i < kGroupWidth; i++)
+            mask |= uint32_t(m_ctrl[i] < 0) << i;
+        return BitMask(mask);
+#endif
+    }
+
+private:
+#ifdef SJ_HASH_MAP_SSE2
+    __m128i m_ctrl;
+#else
+    ctrl_t m_ctrl[kGroupWidth];
+#endif
+};
+
+/**
+ * Quadratic probing over groups. Visits every group exactly once when capacity is a power of two
+ */
+class ProbeSequence
+{
+public:
+    ProbeSequence(size_t hash, size_t mask) : m_mask(mask), m_offset(hash & mask)
+    {
+    }
+
+    [[nodiscard]] size_t Offset() const
+    {
+        return m_offset;
+    }
+
+    [[nodiscard]] size_t Offset(size_t i) const
+    {
+        return (m_offset + i) & m_mask;
+    }
+
+    void Next()
+    {
+        m_index += kGroupWidth;
+        m_offset = (m_offset + m_index) & m_mask;
+    }
+
+    [[nodiscard]] size_t Index() const
+    {
+        return m_index;
+    }
+
+private:
+    size_t m_mask;
+    size_t m_offset;
+    size_t m_index = 0;
+};
+
+/** Spreads weak hashes (std::hash of integers is the identity) across all bits */
+constexpr size_t MixHash(size_t hash)
+{
+    const uint64_t product = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(product ^ (product >> 32));
+}
+
+constexpr size_t H1(size_t hash)
+{
+    return hash >> 7;
+}
+
+constexpr ctrl_t H2(size_t hash)
+{
+    return static_cast<ctrl_t>(hash & 0x7F);
+}
+
+/** Tables keep at least one in eight slots empty so probes always terminate quickly */
+constexpr size_t CapacityToGrowth(size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+constexpr size_t GrowthToCapacity(size_t growth)
+{
+    return std::bit_ceil(std::max(kGroupWidth, growth + (growth + 6) / 7));
+}
+} // namespace sj::hash_map_detail
+
+export namespace sj
+{
+/**
+ * Hashes string_hash keys by their precomputed value, and allows lookups by string without
+ * first building a string_hash
+ */
+struct string_hash_hasher
+{
+    using is_transparent = void;
+
+    size_t operator()(string_hash hash) const
+    {
+        return hash.AsInt();
+    }
+
+    size_t operator()(std::string_view str) const
+    {
+        return string_hash(str).AsInt();
+    }
+
+    size_t operator()(const char* str) const
+    {
+        return string_hash(str).AsInt();
+    }
+};
+
+template <class Key>
+struct default_hasher
+{
+    using type = std::hash<Key>;
+};
+
+template <>
+struct default_hasher<string_hash>
+{
+    using type = string_hash_hasher;
+};
+
+template <class Key>
+using default_hasher_t = default_hasher<Key>::type;
+
+/**
+ * Storage for a hash map whose buffers come from an allocator and grow on demand
+ */
+template <class ValueType, class Allocator = std::pmr::polymorphic_allocator<std::byte>>
+class dynamic_hash_map_storage
+{
+    using ctrl_t = hash_map_detail::ctrl_t;
+
+    static constexpr size_t kBufferAlignment = std::max(alignof(ValueType), alignof(ctrl_t));
+
+    /** Unit the buffers are allocated in, so any allocator rebound to it honors the alignment */
+    struct alignas(kBufferAlignment) buffer_block
+    {
+        std::byte bytes[kBufferAlignment];
+    };
+
+    using block_allocator = std::allocator_traits<Allocator>::template rebind_alloc<buffer_block>;
+    using block_traits = std::allocator_traits<block_allocator>;
+
+public:
+    static constexpr bool kIsGrowable = true;
+
+    using allocator_type = Allocator;
+
+    dynamic_hash_map_storage() = default;
+
+    dynamic_hash_map_storage(const Allocator& alloc) : m_allocator(alloc)
+    {
+    }
+
+    dynamic_hash_map_storage(dynamic_hash_map_storage&& other) noexcept
+        : m_ctrl(std::exchange(other.m_ctrl, nullptr)),
+          m_slots(std::exchange(other.m_slots, nullptr)),
+          m_capacity(std::exchange(other.m_capacity, 0)), m_allocator(other.m_allocator)
+    {
+    }
+
+    dynamic_hash_map_storage(const dynamic_hash_map_storage& other) = delete;
+    dynamic_hash_map_storage& operator=(const dynamic_hash_map_storage& other) = delete;
+    dynamic_hash_map_storage& operator=(dynamic_hash_map_storage&& other) = delete;
+
+    ~dynamic_hash_map_storage()
+    {
+        release_buffers();
+    }
+
+    [[nodiscard]] ctrl_t* ctrl() const
+    {
+        return m_ctrl;
+    }
+
+    [[nodiscard]] ValueType* slots() const
+    {
+        return m_slots;
+    }
+
+    [[nodiscard]] size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    [[nodiscard]] allocator_type get_allocator() const
+    {
+        return m_allocator;
+    }
+
+    /**
+     * Allocates fresh buffers for capacity slots. The caller moves elements across, then passes
+     * the old buffers to release_buffers
+     */
+    void allocate_buffers(size_t capacity)
+    {
+        buffer_block* blocks = block_traits::allocate(m_allocator, block_count(capacity));
+        auto* memory = reinterpret_cast<std::byte*>(blocks);
+
+        m_ctrl = reinterpret_cast<ctrl_t*>(memory);
+        m_slots = reinterpret_cast<ValueType*>(memory + get_slot_offset(capacity));
+        m_capacity = capacity;
+    }
+
+    void release_buffers(ctrl_t* ctrl, size_t capacity)
+    {
+        if(ctrl == nullptr)
+            return;
+
+        block_traits::deallocate(m_allocator,
+                                 reinterpret_cast<buffer_block*>(ctrl),
+                                 block_count(capacity));
+    }
+
+    void release_buffers()
+    {
+        release_buffers(m_ctrl, m_capacity);
+        m_ctrl = nullptr;
+        m_slots = nullptr;
+        m_capacity = 0;
+    }
+
+    void swap(dynamic_hash_map_storage& other) noexcept
+    {
+        std::swap(m_ctrl, other.m_ctrl);
+        std::swap(m_slots, other.m_slots);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_allocator, other.m_allocator);
+    }
+
+private:
+    /** Slots follow the control bytes (plus their cloned tail) in the same allocation */
+    static size_t get_slot_offset(size_t capacity)
+    {
+        const size_t ctrlSize = capacity + hash_map_detail::kGroupWidth;
+        return (ctrlSize + alignof(ValueType) - 1) & ~(alignof(ValueType) - 1);
+    }
+
+    static size_t block_count(size_t capacity)
+    {
+        const size_t allocationSize = get_slot_offset(capacity) + capacity * sizeof(ValueType);
+        return (allocationSize + sizeof(buffer_block) - 1) / sizeof(buffer_block);
+    }
+
+    ctrl_t* m_ctrl = nullptr;
+    ValueType* m_slots = nullptr;
+    size_t m_capacity = 0;
+    [[no_unique_address]] block_allocator m_allocator;
+};
+
+/**
+ * Inline storage for a hash map that holds at most tMaxSize elements and never allocates
+ */
+template <class ValueType, size_t tMaxSize>
+class static_hash_map_storage
+{
+    using ctrl_t = hash_map_detail::ctrl_t;
+
+public:
+    static constexpr bool kIsGrowable = false;
+    static constexpr size_t kCapacity = hash_map_detail::GrowthToCapacity(tMaxSize);
+
+    static_hash_map_storage() = default;
+    static_hash_map_storage(const static_hash_map_storage& other) = delete;
+    static_hash_map_storage& operator=(const static_hash_map_storage& other) = delete;
+
+    [[nodiscard]] ctrl_t* ctrl() const
+    {
+        return const_cast<ctrl_t*>(m_ctrl);
+    }
+
+    [[nodiscard]] ValueType* slots() const
+    {
+        return std::launder(reinterpret_cast<ValueType*>(const_cast<std::byte*>(m_slots)));
+    }
+
+    [[nodiscard]] static constexpr size_t capacity()
+    {
+        return kCapacity;
+    }
+
+private:
+    ctrl_t m_ctrl[kCapacity + hash_map_detail::kGroupWidth];
+    alignas(ValueType) std::byte m_slots[kCapacity * sizeof(ValueType)];
+};
+
+/**
+ * Open addressing hash map in the style of Swiss tables. Slots are grouped in sixteens and each
+ * has a control byte holding 7 bits of its key's hash; a probe compares a whole group of control
+ * bytes at once (SSE2 where available) and only touches slots whose bits match.
+ *
+ * Element references are invalidated by any insert that grows or rehashes the table.
+ * Iteration order is unspecified.
+ */
+template <class Key, class Value, class Storage, class Hash, class KeyEqual>
+class hash_map_interface : private Storage
+{
+    using ctrl_t = hash_map_detail::ctrl_t;
+    using Group = hash_map_detail::Group;
+
+    static constexpr bool kIsTransparent = requires {
+        typename Hash::is_transparent;
+        typename KeyEqual::is_transparent;
+    };
+
+    // Lookup keys that convert to a trivially copyable Key are converted once up front, otherwise
+    // every candidate compared along the probe sequence would redo the conversion (a string hash)
+    template <class K>
+    static constexpr bool kConvertsToKey =
+        std::is_trivially_copyable_v<Key> && std::is_convertible_v<const K&, Key>;
+
+    template <class K>
+    using lookup_key_t = std::conditional_t<kIsTransparent && !kConvertsToKey<K>, K, Key>;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = size_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    template <bool tIsConst>
+    class iterator_base
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = hash_map_interface::value_type;
+        using element_type = std::conditional_t<tIsConst, const value_type, value_type>;
+        using pointer = element_type*;
+        using reference = element_type&;
+
+        iterator_base() = default;
+
+        iterator_base(const ctrl_t* ctrl, const ctrl_t* ctrlEnd, value_type* slot)
+            : m_ctrl(ctrl), m_ctrlEnd(ctrlEnd), m_slot(slot)
+        {
+            skip_empty_slots();
+        }
+
+        /** Allow const iterators to be constructed from non-const ones */
+        iterator_base(const iterator_base<false>& other)
+            : m_ctrl(other.m_ctrl), m_ctrlEnd(other.m_ctrlEnd), m_slot(other.m_slot)
+        {
+        }
+
+        reference operator*() const
+        {
+            return *m_slot;
+        }
+
+        pointer operator->() const
+        {
+            return m_slot;
+        }
+
+        iterator_base& operator++()
+        {
+            m_ctrl++;
+            m_slot++;
+            skip_empty_slots();
+            return *this;
+        }
+
+        iterator_base operator++(int)
+        {
+            iterator_base tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const iterator_base& other) const
+        {
+            return m_ctrl == other.m_ctrl;
+        }
+
+    private:
+        friend class hash_map_interface;
+        template <bool tAnyConst>
+        friend class iterator_base;
+
+        void skip_empty_slots()
+        {
+            while(m_ctrl != m_ctrlEnd && !hash_map_detail::IsFull(*m_ctrl))
+            {
+                m_ctrl++;
+                m_slot++;
+            }
+        }
+
+        const ctrl_t* m_ctrl = nullptr;
+        const ctrl_t* m_ctrlEnd = nullptr;
+        value_type* m_slot = nullptr;
+    };
+
+    using iterator = iterator_base<false>;
+    using const_iterator = iterator_base<true>;
+    static_assert(std::forward_iterator<iterator>);
+    static_assert(std::forward_iterator<const_iterator>);
+
+    hash_map_interface()
+    {
+        if constexpr(!Storage::kIsGrowable)
+            reset_ctrl();
+    }
+
+    template <class Allocator>
+        requires Storage::kIsGrowable && std::constructible_from<Storage, const Allocator&>
+    hash_map_interface(const Allocator& alloc) : Storage(alloc)
+    {
+    }
+
+    hash_map_interface(std::initializer_list<value_type> values) : hash_map_interface()
+    {
+        reserve(values.size());
+        for(const value_type& value : values)
+            insert(value);
+    }
+
+    hash_map_interface(const hash_map_interface& other) : hash_map_interface()
+    {
+        *this = other;
+    }
+
+    hash_map_interface(hash_map_interface&& other) noexcept
+        requires Storage::kIsGrowable
+        : Storage(std::move(static_cast<Storage&>(other))),
+          m_size(std::exchange(other.m_size, 0)),
+          m_growthLeft(std::exchange(other.m_growthLeft, 0))
+    {
+    }
+
+    ~hash_map_interface()
+    {
+        destroy_elements();
+    }
+
+    hash_map_interface& operator=(const hash_map_interface& other)
+    {
+        if(this == &other)
+            return *this;
+
+        clear();
+        reserve(other.size());
+        for(const value_type& value : other)
+            insert(value);
+
+        return *this;
+    }
+
+    hash_map_interface& operator=(hash_map_interface&& other) noexcept
+    {
+        if(this == &other)
+            return *this;
+
+        if constexpr(Storage::kIsGrowable)
+        {
+            if(Storage::get_allocator() == other.Storage::get_allocator())
+            {
+                destroy_elements();
+                Storage::release_buffers();
+                Storage::swap(other);
+                m_size = std::exchange(other.m_size, 0);
+                m_growthLeft = std::exchange(other.m_growthLeft, 0);
+                return *this;
+            }
+        }
+
+        clear();
+        reserve(other.size());
+        for(value_type& value : other)
+            emplace(value.first, std::move(value.second));
+
+        other.clear();
+        return *this;
+    }
+
+    iterator begin()
+    {
+        return iterator(ctrl(), ctrl() + capacity(), slots());
+    }
+
+    const_iterator begin() const
+    {
+        return iterator(ctrl(), ctrl() + capacity(), slots());
+    }
+
+    iterator end()
+    {
+        return iterator(ctrl() + capacity(), ctrl() + capacity(), slots() + capacity());
+    }
+
+    const_iterator end() const
+    {
+        return iterator(ctrl() + capacity(), ctrl() + capacity(), slots() + capacity());
+    }
+
+    [[nodiscard]] size_t size() const
+    {
+        return m_size;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    [[nodiscard]] size_t capacity() const
+    {
+        return Storage::capacity();
+    }
+
+    /** Elements that fit before the table must grow or rehash */
+    [[nodiscard]] size_t max_load() const
+    {
+        return hash_map_detail::CapacityToGrowth(capacity());
+    }
+
+    void clear()
+    {
+        destroy_elements();
+
+        if(capacity() > 0)
+            reset_ctrl();
+    }
+
+    /**
+     * Ensures count elements fit without growing
+     */
+    void reserve(size_t count)
+    {
+        if constexpr(Storage::kIsGrowable)
+        {
+            if(count > max_load())
+                resize(hash_map_detail::GrowthToCapacity(count));
+        }
+        else
+        {
+            SJ_ASSERT(count <= max_load(), "static_hash_map cannot reserve past its capacity");
+        }
+    }
+
+    template <class K>
+    iterator find(const K& key)
+    {
+        return iterator_at(find_index(static_cast<const lookup_key_t<K>&>(key)));
+    }
+
+    template <class K>
+    const_iterator find(const K& key) const
+    {
+        return const_cast<hash_map_interface*>(this)->find(key);
+    }
+
+    template <class K>
+    [[nodiscard]] bool contains(const K& key) const
+    {
+        return find(key) != end();
+    }
+
+    template <class K>
+    [[nodiscard]] size_t count(const K& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    template <class K>
+    auto at(this auto&& self, const K& key) -> auto&& // (const?) Value&
+    {
+        auto it = self.find(key);
+        SJ_ASSERT(it != self.end(), "Key not present in hash map");
+        return it->second;
+    }
+
+    Value& operator[](const Key& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    Value& operator[](Key&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /**
+     * Constructs a value from args if key is not already present
+     * @return Iterator to the element with key and whether it was inserted
+     */
+    template <class K, class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        const lookup_key_t<std::remove_cvref_t<K>>& lookupKey = key;
+        const size_t hash = hash_key(lookupKey);
+        const size_t existing = find_index(lookupKey, hash);
+        if(existing != capacity())
+            return {iterator_at(existing), false};
+
+        const size_t index = prepare_insert(hash);
+        if(index == capacity())
+            return {end(), false};
+
+        std::construct_at(slots() + index,
+                          std::piecewise_construct,
+                          std::forward_as_tuple(std::forward<K>(key)),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+        return {iterator_at(index), true};
+    }
+
+    /** Same as try_emplace, matching the std::map interface used elsewhere in the engine */
+    template <class K, class... Args>
+    std::pair<iterator, bool> emplace(K&& key, Args&&... args)
+    {
+        return try_emplace(std::forward<K>(key), std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return try_emplace(value.first, std::move(value.second));
+    }
+
+    template <class K, class V>
+    std::pair<iterator, bool> insert_or_assign(K&& key, V&& value)
+    {
+        auto result = try_emplace(std::forward<K>(key), std::forward<V>(value));
+        if(!result.second && result.first != end())
+            result.first->second = std::forward<V>(value);
+
+        return result;
+    }
+
+    /**
+     * @return Number of elements removed
+     */
+    template <class K>
+    size_t erase(const K& key)
+    {
+        const size_t index = find_index(static_cast<const lookup_key_t<K>&>(key));
+        if(index == capacity())
+            return 0;
+
+        erase_at(index);
+        return 1;
+    }
+
+    /**
+     * @return Iterator to the element following pos
+     */
+    iterator erase(const_iterator pos)
+    {
+        SJ_ASSERT(pos != end(), "Cannot erase past end of hash map");
+
+        const size_t index = static_cast<size_t>(pos.m_ctrl - ctrl());
+        erase_at(index);
+
+        return iterator(ctrl() + index + 1, ctrl() + capacity(), slots() + index + 1);
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    [[nodiscard]] hasher hash_function() const
+    {
+        return Hash();
+    }
+
+    [[nodiscard]] key_equal key_eq() const
+    {
+        return KeyEqual();
+    }
+
+    auto get_allocator() const
+        requires Storage::kIsGrowable
+    {
+        return Storage::get_allocator();
+    }
+
+private:
+    ctrl_t* ctrl() const
+    {
+        return Storage::ctrl();
+    }
+
+    value_type* slots() const
+    {
+        return Storage::slots();
+    }
+
+    template <class K>
+    static size_t hash_key(const K& key)
+    {
+        return hash_map_detail::MixHash(Hash()(key));
+    }
+
+    iterator iterator_at(size_t index)
+    {
+        if(index == capacity())
+            return end();
+
+        return iterator(ctrl() + index, ctrl() + capacity(), slots() + index);
+    }
+
+    /** Writes a control byte, mirroring the first group into the cloned tail */
+    void set_ctrl(size_t index, ctrl_t value)
+    {
+        ctrl()[index] = value;
+
+        if(index < hash_map_detail::kGroupWidth)
+            ctrl()[capacity() + index] = value;
+    }
+
+    void reset_ctrl()
+    {
+        std::memset(ctrl(), hash_map_detail::kEmpty, capacity() + hash_map_detail::kGroupWidth);
+        m_growthLeft = max_load() - m_size;
+    }
+
+    void destroy_elements()
+    {
+        if constexpr(!std::is_trivially_destructible_v<value_type>)
+        {
+            for(value_type& value : *this)
+                std::destroy_at(&value);
+        }
+
+        m_size = 0;
+    }
+
+    template <class K>
+    size_t find_index(const K& key) const
+    {
+        return find_index(key, hash_key(key));
+    }
+
+    /**
+     * @return Slot index holding key, or capacity() if it is not present
+     */
+    template <class K>
+    size_t find_index(const K& key, size_t hash) const
+    {
+        if(capacity() == 0)
+            return 0;
+
+        const ctrl_t h2 = hash_map_detail::H2(hash);
+        hash_map_detail::ProbeSequence probe(hash_map_detail::H1(hash), capacity() - 1);
+
+        while(true)
+        {
+            const Group group(ctrl() + probe.Offset());
+            for(uint32_t i : group.Match(h2))
+            {
+                const size_t index = probe.Offset(i);
+                if(KeyEqual()(slots()[index].first, key))
+                    return index;
+            }
+
+            if(group.MatchEmpty())
+                return capacity();
+
+            probe.Next();
+            SJ_ASSERT(probe.Index() <= capacity(), "Hash map probe did not terminate");
+        }
+    }
+
+    /**
+     * @return First empty or deleted slot along hash's probe sequence
+     */
+    size_t find_first_non_full(size_t hash) const
+    {
+        hash_map_detail::ProbeSequence probe(hash_map_detail::H1(hash), capacity() - 1);
+
+        while(true)
+        {
+            const Group group(ctrl() + probe.Offset());
+            if(hash_map_detail::BitMask mask = group.MatchEmptyOrDeleted())
+                return probe.Offset(mask.LowestBit());
+
+            probe.Next();
+        }
+    }
+
+    /**
+     * Claims a slot for a new element with hash, growing or rehashing if the table is full
+     * @return Slot index, or capacity() if a static map has no room
+     */
+    size_t prepare_insert(size_t hash)
+    {
+        size_t index = capacity() == 0 ? 0 : find_first_non_full(hash);
+
+        // Reusing a tombstone does not consume growth
+        if(m_growthLeft == 0 && (capacity() == 0 || ctrl()[index] != hash_map_detail::kDeleted))
+        {
+            if(!rehash_and_grow_if_necessary())
+                return capacity();
+
+            index = find_first_non_full(hash);
+        }
+
+        m_growthLeft -= ctrl()[index] == hash_map_detail::kEmpty ? 1 : 0;
+        set_ctrl(index, hash_map_detail::H2(hash));
+        m_size++;
+        return index;
+    }
+
+    bool rehash_and_grow_if_necessary()
+    {
+        const size_t cap = capacity();
+
+        // Mostly tombstones: reclaim them in place rather than doubling
+        if(cap > 0 && m_size * 32 <= cap * 25 && m_size < max_load())
+        {
+            drop_deletes_without_resize();
+            return true;
+        }
+
+        if constexpr(Storage::kIsGrowable)
+        {
+            resize(cap == 0 ? hash_map_detail::kGroupWidth : cap * 2);
+            return true;
+        }
+        else
+        {
+            if(m_size < max_load())
+            {
+                drop_deletes_without_resize();
+                return true;
+            }
+
+            SJ_ASSERT(false, "static_hash_map is full");
+            return false;
+        }
+    }
+
+    void resize(size_t newCapacity)
+        requires Storage::kIsGrowable
+    {
+        ctrl_t* oldCtrl = ctrl();
+        value_type* oldSlots = slots();
+        const size_t oldCapacity = capacity();
+
+        Storage::allocate_buffers(newCapacity);
+        reset_ctrl();
+
+        for(size_t i = 0; i < oldCapacity; i++)
+        {
+            if(!hash_map_detail::IsFull(oldCtrl[i]))
+                continue;
+
+            const size_t hash = hash_key(oldSlots[i].first);
+            const size_t index = find_first_non_full(hash);
+            set_ctrl(index, hash_map_detail::H2(hash));
+
+            std::construct_at(slots() + index, std::move(oldSlots[i]));
+            std::destroy_at(oldSlots + i);
+        }
+
+        m_growthLeft = max_load() - m_size;
+        Storage::release_buffers(oldCtrl, oldCapacity);
+    }
+
+    /**
+     * Rehashes in place, turning tombstones back into empty slots. Needs no memory beyond a
+     * single temporary element, so it is also how static maps recover from churn
+     */
+    void drop_deletes_without_resize()
+    {
+        using namespace hash_map_detail;
+
+        // Mark every live element as needing a new home, and every tombstone as free
+        for(size_t i = 0; i < capacity(); i++)
+            ctrl()[i] = IsFull(ctrl()[i]) ? kDeleted : kEmpty;
+        std::memcpy(ctrl() + capacity(), ctrl(), kGroupWidth);
+
+        const size_t mask = capacity() - 1;
+        for(size_t i = 0; i < capacity(); i++)
+        {
+            if(ctrl()[i] != kDeleted)
+                continue;
+
+            const size_t hash = hash_key(slots()[i].first);
+            const size_t target = find_first_non_full(hash);
+            const size_t probeStart = H1(hash) & mask;
+
+            auto probeGroup = [&](size_t pos) { return ((pos - probeStart) & mask) / kGroupWidth; };
+
+            // Already in the best group it can be
+            if(probeGroup(i) == probeGroup(target))
+            {
+                set_ctrl(i, H2(hash));
+                continue;
+            }
+
+            if(ctrl()[target] == kEmpty)
+            {
+                std::construct_at(slots() + target, std::move(slots()[i]));
+                std::destroy_at(slots() + i);
+                set_ctrl(target, H2(hash));
+                set_ctrl(i, kEmpty);
+            }
+            else
+            {
+                // Target holds another element waiting to be placed, swap and reprocess slot i
+                value_type tmp(std::move(slots()[i]));
+                std::destroy_at(slots() + i);
+                std::construct_at(slots() + i, std::move(slots()[target]));
+                std::destroy_at(slots() + target);
+                std::construct_at(slots() + target, std::move(tmp));
+                set_ctrl(target, H2(hash));
+                i--;
+            }
+        }
+
+        m_growthLeft = max_load() - m_size;
+    }
+
+    void erase_at(size_t index)
+    {
+        using namespace hash_map_detail;
+
+        std::destroy_at(slots() + index);
+        m_size--;
+
+        // If no probe could have passed over this slot while the group was full, it can go
+        // straight back to empty instead of leaving a tombstone
+        const size_t indexBefore = (index - kGroupWidth) & (capacity() - 1);
+        const BitMask emptyAfter = Group(ctrl() + index).MatchEmpty();
+        const BitMask emptyBefore = Group(ctrl() + indexBefore).MatchEmpty();
+
+        const bool wasNeverFull = emptyBefore && emptyAfter &&
+                                  (emptyAfter.TrailingZeros() + emptyBefore.LeadingZeros()) <
+                                      kGroupWidth;
+
+        set_ctrl(index, wasNeverFull ? kEmpty : kDeleted);
+        m_growthLeft += wasNeverFull ? 1 : 0;
+    }
+
+    size_t m_size = 0;
+    size_t m_growthLeft = 0;
+};
+
+/**
+ * Hash map backed by an allocator, growing as needed
+ */
+template <class Key,
+          class Value,
+          class Hash = default_hasher_t<Key>,
+          class KeyEqual = std::equal_to<>,
+          class Allocator = std::pmr::polymorphic_allocator<std::byte>>
+using dynamic_hash_map = hash_map_interface<Key,
+                                            Value,
+                                            dynamic_hash_map_storage<std::pair<const Key, Value>,
+                                                                     Allocator>,
+                                            Hash,
+                                            KeyEqual>;
+
+/**
+ * Hash map holding up to tMaxSize elements inline. Never allocates
+ */
+template <class Key,
+          class Value,
+          size_t tMaxSize,
+          class Hash = default_hasher_t<Key>,
+          class KeyEqual = std::equal_to<>>
+using static_hash_map =
+    hash_map_interface<Key,
+                       Value,
+                       static_hash_map_storage<std::pair<const Key, Value>, tMaxSize>,
+                       Hash,
+                       KeyEqual>;
+
+} // namespace sj
@@ -0,0 +1,187 @@
+module;
+
+// STD Headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <utility>
+
+// Screwjank Headers
+#include <ScrewjankStd/Assert.hpp>
+
+export module sj.std.containers.mpmc_queue;
+import sj.std.memory.utils;
+
+export namespace sj
+{
+/**
+ * Bounded lock-free queue for any number of producers and consumers (Vyukov's algorithm).
+ * Every slot carries a sequence number that tells producers and consumers whose turn it is, so
+ * each operation costs a single CAS on the shared index in the uncontended case.
+ */
+template <class T, class Allocator = std::pmr::polymorphic_allocator<T>>
+class mpmc_queue
+{
+    struct cell
+    {
+        std::atomic<size_t> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    using cell_allocator = std::allocator_traits<Allocator>::template rebind_alloc<cell>;
+    using cell_allocator_traits = std::allocator_traits<cell_allocator>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    /**
+     * @param capacity Maximum number of elements. Must be a power of two
+     */
+    explicit mpmc_queue(size_t capacity, const Allocator& alloc = Allocator())
+        : m_capacity(capacity), m_allocator(alloc)
+    {
+        SJ_ASSERT(capacity != 0 && (capacity & (capacity - 1)) == 0,
+                  "mpmc_queue capacity must be a power of two");
+
+        m_cells = cell_allocator_traits::allocate(m_allocator, m_capacity);
+        for(size_t i = 0; i < m_capacity; i++)
+            new(&m_cells[i].sequence) std::atomic<size_t>(i);
+    }
+
+    mpmc_queue(const mpmc_queue& other) = delete;
+    mpmc_queue(mpmc_queue&& other) = delete;
+    mpmc_queue& operator=(const mpmc_queue& other) = delete;
+    mpmc_queue& operator=(mpmc_queue&& other) = delete;
+
+    ~mpmc_queue()
+    {
+        while(try_pop())
+        {
+        }
+
+        cell_allocator_traits::deallocate(m_allocator, m_cells, m_capacity);
+    }
+
+    /**
+     * Any thread. Constructs an element at the back of the queue
+     * @return False if the queue is full
+     */
+    template <class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        cell* target = nullptr;
+
+        while(true)
+        {
+            target = &m_cells[pos & (m_capacity - 1)];
+            const size_t sequence = target->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+            if(diff == 0)
+            {
+                // Slot is free for this lap, claim it
+                if(m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(diff < 0)
+            {
+                // Slot still holds an element from the previous lap
+                return false;
+            }
+            else
+            {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        new(target->storage) T(std::forward<Args>(args)...);
+        target->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value)
+    {
+        return try_emplace(value);
+    }
+
+    bool try_push(T&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * Any thread. Removes the element at the front of the queue
+     */
+    std::optional<T> try_pop()
+    {
+        size_t pos = m_dequeuePos.load(std::memory_order_relaxed);
+        cell* target = nullptr;
+
+        while(true)
+        {
+            target = &m_cells[pos & (m_capacity - 1)];
+            const size_t sequence = target->sequence.load(std::memory_order_acquire);
+            const intptr_t diff =
+                static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+
+            if(diff == 0)
+            {
+                if(m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if(diff < 0)
+            {
+                // Nothing has been published to this slot yet
+                return std::nullopt;
+            }
+            else
+            {
+                pos = m_dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        T* element = std::launder(reinterpret_cast<T*>(target->storage));
+        std::optional<T> value(std::move(*element));
+        std::destroy_at(element);
+
+        // Hand the slot to the producer one lap ahead
+        target->sequence.store(pos + m_capacity, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @return Approximate number of elements
+     */
+    [[nodiscard]] size_t size() const
+    {
+        const size_t enqueuePos = m_enqueuePos.load(std::memory_order_acquire);
+        const size_t dequeuePos = m_dequeuePos.load(std::memory_order_acquire);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size() == 0;
+    }
+
+    [[nodiscard]] size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+private:
+    cell* m_cells = nullptr;
+    size_t m_capacity = 0;
+    [[no_unique_address]] cell_allocator m_allocator;
+
+    alignas(kCacheLineSize) std::atomic<size_t> m_enqueuePos = 0;
+    alignas(kCacheLineSize) std::atomic<size_t> m_dequeuePos = 0;
+};
+
+} // namespace sj
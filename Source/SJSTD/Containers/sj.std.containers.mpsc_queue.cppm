@@ -0,0 +1,143 @@
+module;
+
+// STD Headers
+#include <atomic>
+#include <concepts>
+
+export module sj.std.containers.mpsc_queue;
+import sj.std.memory.utils;
+
+export namespace sj
+{
+template <class Derived>
+class mpsc_queue;
+
+/**
+ * Intrusive node for mpsc_queue. Like dl_list_node, types opt in by deriving from it:
+ * struct Message : mpsc_queue_node<Message> { ... };
+ * A node may be in at most one queue at a time.
+ */
+template <class Derived>
+class mpsc_queue_node
+{
+protected:
+    mpsc_queue_node() = default;
+
+    // Copies never carry queue linkage with them
+    mpsc_queue_node(const mpsc_queue_node&) : m_next(nullptr)
+    {
+    }
+
+    mpsc_queue_node& operator=(const mpsc_queue_node&)
+    {
+        return *this;
+    }
+
+private:
+    friend class mpsc_queue<Derived>;
+
+    std::atomic<mpsc_queue_node*> m_next = nullptr;
+};
+
+/**
+ * Unbounded lock-free intrusive queue for many producer threads and one consumer thread
+ * (Vyukov's algorithm). Push is wait-free: a single exchange plus a store.
+ * The queue never allocates and assumes no ownership over the nodes that pass through it, so the
+ * caller provides node storage from whichever memory resource suits it.
+ */
+template <class Derived>
+class mpsc_queue
+{
+    using node_type = mpsc_queue_node<Derived>;
+
+public:
+    mpsc_queue() : m_head(&m_stub), m_tail(&m_stub)
+    {
+        static_assert(std::derived_from<Derived, node_type>,
+                      "mpsc_queue elements must derive from mpsc_queue_node");
+    }
+
+    mpsc_queue(const mpsc_queue& other) = delete;
+    mpsc_queue(mpsc_queue&& other) = delete;
+    mpsc_queue& operator=(const mpsc_queue& other) = delete;
+    mpsc_queue& operator=(mpsc_queue&& other) = delete;
+
+    /**
+     * Any thread. Appends node to the back of the queue
+     */
+    void push(Derived* node)
+    {
+        push_node(node);
+    }
+
+    /**
+     * Consumer only. Removes the node at the front of the queue
+     * @return The node, or nullptr if the queue is empty or a producer is midway through a push
+     */
+    Derived* try_pop()
+    {
+        node_type* tail = m_tail;
+        node_type* next = tail->m_next.load(std::memory_order_acquire);
+
+        // Skip over the stub, it only exists to keep the queue non-empty
+        if(tail == &m_stub)
+        {
+            if(next == nullptr)
+                return nullptr;
+
+            m_tail = next;
+            tail = next;
+            next = next->m_next.load(std::memory_order_acquire);
+        }
+
+        if(next != nullptr)
+        {
+            m_tail = next;
+            return static_cast<Derived*>(tail);
+        }
+
+        // tail looks like the last node. If it isn't, a producer has swapped head but not yet
+        // linked its node, so report empty and let the caller retry later
+        if(tail != m_head.load(std::memory_order_acquire))
+            return nullptr;
+
+        // Re-insert the stub behind the last node so it can be detached
+        push_node(&m_stub);
+
+        next = tail->m_next.load(std::memory_order_acquire);
+        if(next != nullptr)
+        {
+            m_tail = next;
+            return static_cast<Derived*>(tail);
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * Consumer only. True if no fully published nodes remain
+     */
+    [[nodiscard]] bool empty() const
+    {
+        const node_type* tail = m_tail;
+        if(tail == &m_stub)
+            return tail->m_next.load(std::memory_order_acquire) == nullptr;
+
+        return false;
+    }
+
+private:
+    void push_node(node_type* node)
+    {
+        node->m_next.store(nullptr, std::memory_order_relaxed);
+        node_type* prev = m_head.exchange(node, std::memory_order_acq_rel);
+        prev->m_next.store(node, std::memory_order_release);
+    }
+
+    // Producers contend on head, the consumer owns tail
+    alignas(kCacheLineSize) std::atomic<node_type*> m_head;
+    alignas(kCacheLineSize) node_type* m_tail;
+    node_type m_stub;
+};
+
+} // namespace sj
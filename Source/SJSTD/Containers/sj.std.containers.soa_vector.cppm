@@ -0,0 +1,475 @@
+module;
+
+// STD Headers
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <memory_resource>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// Screwjank Headers
+#include <ScrewjankStd/Assert.hpp>
+
+export module sj.std.containers.soa_vector;
+import sj.std.containers.vector;
+
+export namespace sj
+{
+    /**
+     * Growable structure-of-arrays container. Element i is the tuple of the i-th entry of every
+     * column. All columns share one allocation, and each column starts on a kColumnAlignment
+     * boundary so vectorized loops over a single column never straddle an alignment boundary
+     * at the start.
+     */
+    template <class... Ts>
+    class soa_vector
+    {
+        static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one column");
+
+        static constexpr size_t kNumColumns = sizeof...(Ts);
+
+        template <size_t I>
+        using column_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+        template <bool tIsConst>
+        class iterator_base
+        {
+            using container_type = std::conditional_t<tIsConst, const soa_vector, soa_vector>;
+
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::tuple<Ts...>;
+            using reference =
+                std::conditional_t<tIsConst, std::tuple<const Ts&...>, std::tuple<Ts&...>>;
+
+            iterator_base() = default;
+
+            iterator_base(container_type* container, size_t index) noexcept
+                : m_container(container), m_index(index)
+            {
+            }
+
+            /** Allows iterator -> const_iterator */
+            iterator_base(const iterator_base<false>& other) noexcept
+                : m_container(other.m_container), m_index(other.m_index)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return (*m_container)[m_index];
+            }
+
+            reference operator[](difference_type offset) const noexcept
+            {
+                return (*m_container)[m_index + offset];
+            }
+
+            [[nodiscard]] size_t index() const noexcept
+            {
+                return m_index;
+            }
+
+            iterator_base& operator++() noexcept
+            {
+                m_index++;
+                return *this;
+            }
+
+            iterator_base operator++(int) noexcept
+            {
+                iterator_base temp = *this;
+                m_index++;
+                return temp;
+            }
+
+            iterator_base& operator--() noexcept
+            {
+                m_index--;
+                return *this;
+            }
+
+            iterator_base operator--(int) noexcept
+            {
+                iterator_base temp = *this;
+                m_index--;
+                return temp;
+            }
+
+            iterator_base& operator+=(difference_type offset) noexcept
+            {
+                m_index += offset;
+                return *this;
+            }
+
+            iterator_base& operator-=(difference_type offset) noexcept
+            {
+                m_index -= offset;
+                return *this;
+            }
+
+            friend iterator_base operator+(iterator_base it, difference_type offset) noexcept
+            {
+                return it += offset;
+            }
+
+            friend iterator_base operator-(iterator_base it, difference_type offset) noexcept
+            {
+                return it -= offset;
+            }
+
+            friend difference_type operator-(const iterator_base& lhs,
+                                             const iterator_base& rhs) noexcept
+            {
+                return difference_type(lhs.m_index) - difference_type(rhs.m_index);
+            }
+
+            friend bool operator==(const iterator_base& lhs, const iterator_base& rhs) noexcept
+            {
+                return lhs.m_index == rhs.m_index;
+            }
+
+            friend auto operator<=>(const iterator_base& lhs, const iterator_base& rhs) noexcept
+            {
+                return lhs.m_index <=> rhs.m_index;
+            }
+
+        private:
+            friend class iterator_base<true>;
+
+            container_type* m_container = nullptr;
+            size_t m_index = 0;
+        };
+
+    public:
+        using value_type = std::tuple<Ts...>;
+        using reference = std::tuple<Ts&...>;
+        using const_reference = std::tuple<const Ts&...>;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+        using size_type = size_t;
+        using iterator = iterator_base<false>;
+        using const_iterator = iterator_base<true>;
+
+        /** Alignment of the first element of every column. Covers 256 and 512 bit vector loads */
+        static constexpr size_t kColumnAlignment = std::max({size_t(64), alignof(Ts)...});
+
+        soa_vector() = default;
+
+        soa_vector(const allocator_type& alloc) noexcept : m_allocator(alloc)
+        {
+        }
+
+        soa_vector(size_t capacity, const allocator_type& alloc = allocator_type())
+            : m_allocator(alloc)
+        {
+            reserve(capacity);
+        }
+
+        soa_vector(const soa_vector& other) = delete;
+        soa_vector& operator=(const soa_vector& other) = delete;
+
+        soa_vector(soa_vector&& other) noexcept
+            : m_allocator(other.m_allocator),
+              m_buffer(std::exchange(other.m_buffer, nullptr)),
+              m_columns(std::exchange(other.m_columns, {})),
+              m_size(std::exchange(other.m_size, 0)),
+              m_capacity(std::exchange(other.m_capacity, 0))
+        {
+        }
+
+        soa_vector& operator=(soa_vector&& other) noexcept
+        {
+            if(this == &other)
+                return *this;
+
+            clear();
+
+            if(m_allocator == other.m_allocator)
+            {
+                release_buffer();
+
+                m_buffer = std::exchange(other.m_buffer, nullptr);
+                m_columns = std::exchange(other.m_columns, {});
+                m_size = std::exchange(other.m_size, 0);
+                m_capacity = std::exchange(other.m_capacity, 0);
+
+                return *this;
+            }
+
+            // other's buffer belongs to its allocator, so move the elements into storage of ours
+            reserve(other.m_size);
+            [&]<size_t... Is>(std::index_sequence<Is...>) {
+                (relocate_elements(std::get<Is>(m_columns),
+                                   std::get<Is>(other.m_columns),
+                                   other.m_size),
+                 ...);
+            }(std::index_sequence_for<Ts...>());
+
+            m_size = std::exchange(other.m_size, 0);
+
+            return *this;
+        }
+
+        ~soa_vector()
+        {
+            clear();
+            release_buffer();
+        }
+
+        /**
+         * Constructs a new element at the back from one argument per column
+         * @return Tuple of references to the new element's members
+         */
+        template <class... Args>
+            requires(sizeof...(Args) == kNumColumns)
+        reference emplace_back(Args&&... args)
+        {
+            if(m_size == m_capacity)
+                grow();
+
+            construct_at(m_size, std::forward_as_tuple(std::forward<Args>(args)...));
+            m_size++;
+
+            return (*this)[m_size - 1];
+        }
+
+        reference push_back(const value_type& value)
+        {
+            return std::apply([this](const Ts&... members) { return emplace_back(members...); },
+                              value);
+        }
+
+        reference push_back(value_type&& value)
+        {
+            return std::apply(
+                [this](Ts&... members) { return emplace_back(std::move(members)...); },
+                value);
+        }
+
+        void pop_back() noexcept
+        {
+            SJ_ASSERT(!empty(), "Cannot pop empty soa_vector");
+
+            m_size--;
+            destroy_at(m_size);
+        }
+
+        /**
+         * Removes the element at index by moving the last element into its place.
+         * Applied to every column, so rows stay aligned across columns
+         */
+        void erase_unordered(size_t index) noexcept
+        {
+            SJ_ASSERT(index < m_size, "Erase index out of bounds");
+
+            const size_t last = m_size - 1;
+            if(index != last)
+            {
+                for_each_column([index, last](auto* column) {
+                    column[index] = std::move(column[last]);
+                });
+            }
+
+            pop_back();
+        }
+
+        iterator erase_unordered(const_iterator pos) noexcept
+        {
+            erase_unordered(pos.index());
+            return begin() + pos.index();
+        }
+
+        void clear() noexcept
+        {
+            for_each_column([this](auto* column) {
+                using T = std::remove_pointer_t<decltype(column)>;
+                if constexpr(!std::is_trivially_destructible_v<T>)
+                {
+                    for(size_t i = 0; i < m_size; i++)
+                        column[i].~T();
+                }
+            });
+
+            m_size = 0;
+        }
+
+        void reserve(size_t new_capacity)
+        {
+            if(new_capacity <= m_capacity)
+                return;
+
+            const std::array<size_t, kNumColumns + 1> offsets = column_offsets(new_capacity);
+            auto* new_buffer =
+                static_cast<std::byte*>(m_allocator.allocate_bytes(offsets.back(), kColumnAlignment));
+
+            std::tuple<Ts*...> new_columns;
+            [&]<size_t... Is>(std::index_sequence<Is...>) {
+                ((std::get<Is>(new_columns) =
+                      reinterpret_cast<column_type<Is>*>(new_buffer + offsets[Is])),
+                 ...);
+
+                (relocate_elements(std::get<Is>(new_columns), std::get<Is>(m_columns), m_size),
+                 ...);
+            }(std::index_sequence_for<Ts...>());
+
+            release_buffer();
+
+            m_buffer = new_buffer;
+            m_columns = new_columns;
+            m_capacity = new_capacity;
+        }
+
+        /** Contiguous, kColumnAlignment aligned view of the I-th member of every element */
+        template <size_t I>
+        std::span<column_type<I>> column() noexcept
+        {
+            return std::span(std::get<I>(m_columns), m_size);
+        }
+
+        template <size_t I>
+        std::span<const column_type<I>> column() const noexcept
+        {
+            return std::span<const column_type<I>>(std::get<I>(m_columns), m_size);
+        }
+
+        reference operator[](size_t index) noexcept
+        {
+            SJ_ASSERT(index < m_size, "Out of bounds access");
+            return std::apply([index](Ts*... columns) { return reference(columns[index]...); },
+                              m_columns);
+        }
+
+        const_reference operator[](size_t index) const noexcept
+        {
+            SJ_ASSERT(index < m_size, "Out of bounds access");
+            return std::apply(
+                [index](Ts*... columns) { return const_reference(columns[index]...); },
+                m_columns);
+        }
+
+        reference back() noexcept
+        {
+            return (*this)[m_size - 1];
+        }
+
+        const_reference back() const noexcept
+        {
+            return (*this)[m_size - 1];
+        }
+
+        iterator begin() noexcept
+        {
+            return iterator(this, 0);
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(this, m_size);
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator(this, 0);
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator(this, m_size);
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return m_size;
+        }
+
+        [[nodiscard]] size_t capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return m_allocator;
+        }
+
+    private:
+        /**
+         * Byte offset of every column in a buffer holding capacity elements.
+         * The final entry is the total size of the buffer
+         */
+        static constexpr std::array<size_t, kNumColumns + 1> column_offsets(size_t capacity)
+        {
+            constexpr std::array<size_t, kNumColumns> sizes = {sizeof(Ts)...};
+
+            std::array<size_t, kNumColumns + 1> offsets = {};
+            for(size_t i = 0; i < kNumColumns; i++)
+            {
+                const size_t column_end = offsets[i] + sizes[i] * capacity;
+                offsets[i + 1] = (column_end + kColumnAlignment - 1) & ~(kColumnAlignment - 1);
+            }
+
+            return offsets;
+        }
+
+        template <class Fn>
+        void for_each_column(Fn&& fn)
+        {
+            std::apply([&fn](Ts*... columns) { (fn(columns), ...); }, m_columns);
+        }
+
+        template <class ArgsTuple>
+        void construct_at(size_t index, ArgsTuple&& args)
+        {
+            [&]<size_t... Is>(std::index_sequence<Is...>) {
+                (new(&std::get<Is>(m_columns)[index])
+                     column_type<Is>(std::get<Is>(std::forward<ArgsTuple>(args))),
+                 ...);
+            }(std::index_sequence_for<Ts...>());
+        }
+
+        void destroy_at(size_t index) noexcept
+        {
+            for_each_column([index](auto* column) {
+                using T = std::remove_pointer_t<decltype(column)>;
+                if constexpr(!std::is_trivially_destructible_v<T>)
+                    column[index].~T();
+            });
+        }
+
+        void grow()
+        {
+            reserve(m_capacity == 0 ? 8 : m_capacity * 2);
+        }
+
+        void release_buffer() noexcept
+        {
+            if(m_buffer)
+            {
+                m_allocator.deallocate_bytes(m_buffer,
+                                             column_offsets(m_capacity).back(),
+                                             kColumnAlignment);
+            }
+
+            m_buffer = nullptr;
+            m_columns = {};
+            m_capacity = 0;
+        }
+
+        allocator_type m_allocator = {};
+        std::byte* m_buffer = nullptr;
+        std::tuple<Ts*...> m_columns = {};
+        size_t m_size = 0;
+        size_t m_capacity = 0;
+    };
+} // namespace sj
@@ -0,0 +1,156 @@
+module;
+
+// STD Headers
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <utility>
+
+// Screwjank Headers
+#include <ScrewjankStd/Assert.hpp>
+
+export module sj.std.containers.spsc_queue;
+import sj.std.memory.utils;
+
+export namespace sj
+{
+/**
+ * Bounded lock-free ring buffer for exactly one producer thread and one consumer thread.
+ * Each side keeps a cached copy of the other side's index so the shared cache lines are only
+ * touched when the queue looks full or empty.
+ */
+template <class T, class Allocator = std::pmr::polymorphic_allocator<T>>
+class spsc_queue
+{
+    using allocator_traits = std::allocator_traits<Allocator>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    /**
+     * @param capacity Maximum number of elements. Must be a power of two
+     */
+    explicit spsc_queue(size_t capacity, const Allocator& alloc = Allocator())
+        : m_capacity(capacity), m_allocator(alloc)
+    {
+        SJ_ASSERT(capacity != 0 && (capacity & (capacity - 1)) == 0,
+                  "spsc_queue capacity must be a power of two");
+
+        m_buffer = allocator_traits::allocate(m_allocator, m_capacity);
+    }
+
+    spsc_queue(const spsc_queue& other) = delete;
+    spsc_queue(spsc_queue&& other) = delete;
+    spsc_queue& operator=(const spsc_queue& other) = delete;
+    spsc_queue& operator=(spsc_queue&& other) = delete;
+
+    ~spsc_queue()
+    {
+        while(try_pop())
+        {
+        }
+
+        allocator_traits::deallocate(m_allocator, m_buffer, m_capacity);
+    }
+
+    /**
+     * Producer only. Constructs an element at the back of the queue
+     * @return False if the queue is full
+     */
+    template <class... Args>
+    bool try_emplace(Args&&... args)
+    {
+        const size_t tail = m_producer.tail.load(std::memory_order_relaxed);
+
+        if(tail - m_producer.cachedHead == m_capacity)
+        {
+            m_producer.cachedHead = m_consumer.head.load(std::memory_order_acquire);
+            if(tail - m_producer.cachedHead == m_capacity)
+                return false;
+        }
+
+        allocator_traits::construct(m_allocator,
+                                    &m_buffer[tail & (m_capacity - 1)],
+                                    std::forward<Args>(args)...);
+
+        m_producer.tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_push(const T& value)
+    {
+        return try_emplace(value);
+    }
+
+    bool try_push(T&& value)
+    {
+        return try_emplace(std::move(value));
+    }
+
+    /**
+     * Consumer only. Removes the element at the front of the queue
+     */
+    std::optional<T> try_pop()
+    {
+        const size_t head = m_consumer.head.load(std::memory_order_relaxed);
+
+        if(head == m_consumer.cachedTail)
+        {
+            m_consumer.cachedTail = m_producer.tail.load(std::memory_order_acquire);
+            if(head == m_consumer.cachedTail)
+                return std::nullopt;
+        }
+
+        T* slot = &m_buffer[head & (m_capacity - 1)];
+        std::optional<T> value(std::move(*slot));
+        allocator_traits::destroy(m_allocator, slot);
+
+        m_consumer.head.store(head + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @return Approximate number of elements. Exact only when neither side is active
+     */
+    [[nodiscard]] size_t size() const
+    {
+        const size_t tail = m_producer.tail.load(std::memory_order_acquire);
+        const size_t head = m_consumer.head.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return size() == 0;
+    }
+
+    [[nodiscard]] size_t capacity() const
+    {
+        return m_capacity;
+    }
+
+private:
+    struct alignas(kCacheLineSize) producer_state
+    {
+        std::atomic<size_t> tail = 0;
+        size_t cachedHead = 0;
+    };
+
+    struct alignas(kCacheLineSize) consumer_state
+    {
+        std::atomic<size_t> head = 0;
+        size_t cachedTail = 0;
+    };
+
+    T* m_buffer = nullptr;
+    size_t m_capacity = 0;
+    [[no_unique_address]] Allocator m_allocator;
+
+    producer_state m_producer;
+    consumer_state m_consumer;
+};
+
+} // namespace sj
@@ -2,7 +2,9 @@ module;
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstddef>
+#include <cstdint>
 #include <memory_resource>
 #include <type_traits>
 #include <utility>
@@ -12,6 +14,19 @@ module;
 export module sj.std.containers.type_list;
 import sj.std.type_traits;
 
+namespace sj::type_map_detail
+{
+    /** Well mixed 32 bits of key for a given seed. Seed 0 picks the bucket, others the slot */
+    constexpr uint32_t Mix(uint64_t key, uint64_t seed)
+    {
+        uint64_t h = (key ^ (seed * 0x9e3779b97f4a7c15ull)) * 0xbf58476d1ce4e5b9ull;
+        h ^= h >> 31;
+        h *= 0x94d049bb133111ebull;
+        h ^= h >> 29;
+        return static_cast<uint32_t>(h);
+    }
+} // namespace sj::type_map_detail
+
 export namespace sj
 {
     template<class ... Types>
@@ -56,39 +71,163 @@ export namespace sj
         using list = type_list<LHS..., RHS...>;
     };
 
+    /**
+     * Constant map from a key computed for each type in tTypeList to a value computed for it.
+     * Construction builds a perfect hash over the keys (hash and displace): each key's bucket
+     * stores a seed that sends every key in the bucket to its own slot, so lookups cost two hashes
+     * and a compare however many types the list holds. Keys must be unique integers or enums
+     */
     template <auto tTypeList, class KeyType, class ValueType, auto tToKeyFn, auto tToValueFn>
     class type_map
     {
+        static_assert(std::is_integral_v<KeyType> || std::is_enum_v<KeyType>,
+                      "type_map keys must be integers or enums");
+
+        static constexpr size_t kSize = tTypeList.size();
+        static constexpr size_t kTableSize = std::bit_ceil(std::max<size_t>(kSize, 1));
+        static constexpr uint32_t kEmptySlot = ~uint32_t(0);
+
+        /** Seeds tried per bucket before giving up. Duplicate keys are rejected before searching */
+        static constexpr uint32_t kMaxSeed = 1u << 20;
+
     public:
         constexpr type_map() 
             : m_keys(tTypeList.template transform_list<tToKeyFn, KeyType>()),
               m_values(tTypeList.template transform_list<tToValueFn, ValueType>())
         {
-
+            build_perfect_hash();
         }
+
         [[nodiscard]] constexpr auto get(const KeyType& key) const -> const ValueType&
         {
-            auto keyIt = std::ranges::find(m_keys, key);
-            size_t offset = std::distance(m_keys.begin(), keyIt);
-            auto valueIt = m_values.begin() + offset;
-            SJ_ASSERT(valueIt != m_values.end(), "Failed to find key in compile time map");
-            return *valueIt;
+            const ValueType* value = find(key);
+            SJ_ASSERT(value != nullptr, "Failed to find key in compile time map");
+            return *value;
         }
 
         [[nodiscard]] constexpr auto find(const KeyType& key) const -> const ValueType*
         {
-            auto keyIt = std::ranges::find(m_keys, key);
-            size_t offset = std::distance(m_keys.begin(), keyIt);
-            auto valueIt = m_values.begin() + offset;
-            if(valueIt == m_values.end())
+            const uint32_t index = m_slots[slot_of(key, m_seeds[bucket_of(key)])];
+
+            if(index == kEmptySlot || m_keys[index] != key)
                 return nullptr;
-            else
-                return &*valueIt;
+
+            return &m_values[index];
         }
 
     private:
-        std::array<KeyType, tTypeList.size()> m_keys;
-        std::array<ValueType, tTypeList.size()> m_values;
+        static constexpr size_t bucket_of(const KeyType& key)
+        {
+            return type_map_detail::Mix(static_cast<uint64_t>(key), 0) & (kTableSize - 1);
+        }
+
+        static constexpr size_t slot_of(const KeyType& key, uint32_t seed)
+        {
+            return type_map_detail::Mix(static_cast<uint64_t>(key), seed) & (kTableSize - 1);
+        }
+
+        constexpr void build_perfect_hash()
+        {
+            m_slots.fill(kEmptySlot);
+            m_seeds.fill(1);
+
+            // Group key indices by bucket
+            std::array<uint32_t, kTableSize + 1> bucketStart = {};
+            for(const KeyType& key : m_keys)
+                bucketStart[bucket_of(key) + 1]++;
+
+            for(size_t i = 1; i < bucketStart.size(); i++)
+                bucketStart[i] += bucketStart[i - 1];
+
+            std::array<uint32_t, kSize> bucketKeys = {};
+            std::array<uint32_t, kTableSize> fill = {};
+            for(uint32_t i = 0; i < kSize; i++)
+            {
+                const size_t bucket = bucket_of(m_keys[i]);
+                bucketKeys[bucketStart[bucket] + fill[bucket]++] = i;
+            }
+
+            // Equal keys always land in the same bucket, and no seed can ever separate them, so
+            // reject them here rather than letting the seed search run into the constexpr limits
+            const bool keysUnique = are_bucket_keys_unique(bucketStart, bucketKeys);
+            SJ_ASSERT(keysUnique, "type_map keys must be unique");
+            if(!keysUnique)
+                return;
+
+            // Place the most crowded buckets first while the table is still mostly empty
+            std::array<uint32_t, kTableSize> order = {};
+            for(uint32_t i = 0; i < kTableSize; i++)
+                order[i] = i;
+
+            std::ranges::sort(order, [&bucketStart](uint32_t lhs, uint32_t rhs) {
+                return bucketStart[lhs + 1] - bucketStart[lhs] > bucketStart[rhs + 1] - bucketStart[rhs];
+            });
+
+            for(uint32_t bucket : order)
+            {
+                const uint32_t begin = bucketStart[bucket];
+                const uint32_t end = bucketStart[bucket + 1];
+                if(begin == end)
+                    break;
+
+                bool placed = false;
+                for(uint32_t seed = 1; !placed && seed < kMaxSeed; seed++)
+                {
+                    placed = try_place_bucket(bucketKeys, begin, end, seed);
+                    if(placed)
+                        m_seeds[bucket] = seed;
+                }
+
+                SJ_ASSERT(placed, "type_map could not separate its keys. Are they unique?");
+            }
+        }
+
+        constexpr bool are_bucket_keys_unique(
+            const std::array<uint32_t, kTableSize + 1>& bucketStart,
+            const std::array<uint32_t, kSize>& bucketKeys) const
+        {
+            for(size_t bucket = 0; bucket < kTableSize; bucket++)
+            {
+                for(uint32_t i = bucketStart[bucket]; i < bucketStart[bucket + 1]; i++)
+                {
+                    for(uint32_t j = i + 1; j < bucketStart[bucket + 1]; j++)
+                    {
+                        if(m_keys[bucketKeys[i]] == m_keys[bucketKeys[j]])
+                            return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        /** Claims a free slot for every key in the bucket under seed, or claims nothing */
+        constexpr bool try_place_bucket(const std::array<uint32_t, kSize>& bucketKeys,
+                                        uint32_t begin,
+                                        uint32_t end,
+                                        uint32_t seed)
+        {
+            for(uint32_t i = begin; i < end; i++)
+            {
+                const size_t slot = slot_of(m_keys[bucketKeys[i]], seed);
+                if(m_slots[slot] != kEmptySlot)
+                {
+                    for(uint32_t j = begin; j < i; j++)
+                        m_slots[slot_of(m_keys[bucketKeys[j]], seed)] = kEmptySlot;
+
+                    return false;
+                }
+
+                m_slots[slot] = bucketKeys[i];
+            }
+
+            return true;
+        }
+
+        std::array<KeyType, kSize> m_keys;
+        std::array<ValueType, kSize> m_values;
+        std::array<uint32_t, kTableSize> m_seeds = {};
+        std::array<uint32_t, kTableSize> m_slots = {};
     };
 
 }
@@ -9,10 +9,14 @@ module;
 #include <cmath>
 #include <memory_resource>
 #include <ranges>
+#include <cstring>
+#include <utility>
 #include <ScrewjankStd/Assert.hpp>
 
 // End global module fragment
 export module sj.std.containers.vector;
+import sj.std.memory.resources.memory_resource;
+import sj.std.type_traits;
 
 export namespace sj
 {
@@ -43,6 +47,48 @@ export namespace sj
     template <class T, size_t N>
     using static_vector_storage = std::array<T, N>;
 
+    /**
+     * Moves count elements from src to uninitialized memory at dst and ends their lifetimes at src.
+     * Ranges may overlap when dst < src
+     */
+    template <class T>
+    constexpr void relocate_elements(T* dst, T* src, size_t count) noexcept
+    {
+        if constexpr(is_trivially_relocatable_v<T>)
+        {
+            if(!std::is_constant_evaluated())
+            {
+                if(count > 0)
+                    std::memmove(static_cast<void*>(dst), src, count * sizeof(T));
+
+                return;
+            }
+        }
+
+        for(size_t i = 0; i < count; i++)
+        {
+            new(&dst[i]) T(std::move(src[i]));
+            src[i].~T();
+        }
+    }
+
+    /**
+     * Asks the sj::memory_resource behind allocator to grow buffer without moving it.
+     * Always fails for allocators that don't expose a resource
+     */
+    template <class T, class Allocator>
+    bool try_expand_allocation(Allocator& allocator, T* buffer, size_t old_cap, size_t new_cap) noexcept
+    {
+        if constexpr(requires { allocator.resource(); })
+        {
+            auto* resource = dynamic_cast<sj::memory_resource*>(allocator.resource());
+            if(resource)
+                return resource->try_expand(buffer, old_cap * sizeof(T), new_cap * sizeof(T));
+        }
+
+        return false;
+    }
+
     template <class T, class Allocator = std::pmr::polymorphic_allocator<T>>
     class dynamic_vector_storage
     {
@@ -92,7 +138,7 @@ export namespace sj
 
         dynamic_vector_storage& operator=(const dynamic_vector_storage& other) noexcept
         {
-            reserve(other.size());
+            reserve(other.size(), 0);
 
             for(int i = 0; auto& entry : other)
             {
@@ -105,21 +151,28 @@ export namespace sj
             return *this;
         }
 
-        void reserve(size_t new_cap) noexcept
+        /**
+         * Grows the buffer to hold at least new_cap elements
+         * @param live_count Number of constructed elements at the front of the buffer
+         */
+        void reserve(size_t new_cap, size_t live_count) noexcept
         {
             if(new_cap <= capacity)
                 return;
 
-            T* new_buffer = allocator.allocate(new_cap);
-
-            // Move old buffer into new buffer
-            for(size_t i = 0; i < capacity; i++)
+            if(buffer && try_expand_allocation(allocator, buffer, capacity, new_cap))
             {
-                new(&new_buffer[i]) T(std::move((*this)[i]));
+                capacity = new_cap;
+                return;
             }
 
+            T* new_buffer = allocator.allocate(new_cap);
+
             if(buffer)
+            {
+                relocate_elements(new_buffer, buffer, live_count);
                 allocator.deallocate(buffer, capacity);
+            }
 
             buffer = new_buffer;
             capacity = new_cap;
@@ -150,7 +203,7 @@ export namespace sj
             return self.buffer[idx];
         }
 
-        allocator_type get_allocator()
+        allocator_type get_allocator() const
         {
             return allocator;
         }
@@ -160,6 +213,26 @@ export namespace sj
             return buffer[index];
         }
 
+        /**
+         * Takes the live elements of other. This storage must hold no live elements.
+         * Steals other's buffer when the allocators are interchangeable, otherwise relocates
+         */
+        void move_from(dynamic_vector_storage& other, size_t live_count) noexcept
+        {
+            if(allocator == other.allocator)
+            {
+                if(buffer)
+                    allocator.deallocate(buffer, capacity);
+
+                buffer = std::exchange(other.buffer, nullptr);
+                capacity = std::exchange(other.capacity, 0);
+                return;
+            }
+
+            reserve(live_count, 0);
+            relocate_elements(buffer, other.buffer, live_count);
+        }
+
     protected:
         T* buffer = nullptr;
         size_t capacity = 0;
@@ -168,6 +241,133 @@ export namespace sj
         allocator_type allocator = {};
     };
 
+    /**
+     * Storage for up to N elements inside the object itself, spilling to allocator beyond that.
+     * Copies and moves go through vector_interface since only it knows how many elements are live
+     */
+    template <class T, size_t N, class Allocator = std::pmr::polymorphic_allocator<T>>
+    class small_vector_storage
+    {
+        static_assert(N > 0, "Use dynamic_vector_storage when there is no inline capacity");
+
+    public:
+        using iterator = T*;
+        using const_iterator = const T*;
+        using allocator_type = Allocator;
+        using value_type = T;
+        using reference = T&;
+        using const_reference = const T&;
+
+        small_vector_storage() = default;
+
+        small_vector_storage(const Allocator& alloc) noexcept : allocator(alloc)
+        {
+        }
+
+        small_vector_storage(const small_vector_storage& other) = delete;
+        small_vector_storage& operator=(const small_vector_storage& other) = delete;
+
+        ~small_vector_storage() noexcept
+        {
+            if(!is_inline())
+                allocator.deallocate(buffer, capacity);
+        }
+
+        /**
+         * Grows the buffer to hold at least new_cap elements
+         * @param live_count Number of constructed elements at the front of the buffer
+         */
+        void reserve(size_t new_cap, size_t live_count) noexcept
+        {
+            if(new_cap <= capacity)
+                return;
+
+            if(!is_inline() && try_expand_allocation(allocator, buffer, capacity, new_cap))
+            {
+                capacity = new_cap;
+                return;
+            }
+
+            T* new_buffer = allocator.allocate(new_cap);
+            relocate_elements(new_buffer, buffer, live_count);
+
+            if(!is_inline())
+                allocator.deallocate(buffer, capacity);
+
+            buffer = new_buffer;
+            capacity = new_cap;
+        }
+
+        /**
+         * Takes the live elements of other. This storage must hold no live elements.
+         * Inline elements are always relocated, heap buffers are stolen when the allocators allow
+         */
+        void move_from(small_vector_storage& other, size_t live_count) noexcept
+        {
+            if(!other.is_inline() && allocator == other.allocator)
+            {
+                if(!is_inline())
+                    allocator.deallocate(buffer, capacity);
+
+                buffer = std::exchange(other.buffer, other.inline_buffer());
+                capacity = std::exchange(other.capacity, N);
+                return;
+            }
+
+            reserve(live_count, 0);
+            relocate_elements(buffer, other.buffer, live_count);
+        }
+
+        /** True while the elements live in the inline buffer */
+        [[nodiscard]] bool is_inline() const noexcept
+        {
+            return buffer == inline_buffer();
+        }
+
+        auto begin(this auto&& self) noexcept
+        {
+            return self.buffer;
+        }
+
+        auto end(this auto&& self) noexcept
+        {
+            return &(self.buffer[self.capacity]);
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return capacity;
+        }
+
+        auto data(this auto&& self) noexcept
+        {
+            return self.buffer;
+        }
+
+        decltype(auto) operator[](this auto&& self, size_t idx) noexcept
+        {
+            return self.buffer[idx];
+        }
+
+        allocator_type get_allocator() const
+        {
+            return allocator;
+        }
+
+    protected:
+        T* buffer = inline_buffer();
+        size_t capacity = N;
+
+    private:
+        T* inline_buffer() const noexcept
+        {
+            return reinterpret_cast<T*>(const_cast<std::byte*>(m_inline));
+        }
+
+        alignas(T) std::byte m_inline[N * sizeof(T)];
+        allocator_type allocator = {};
+    };
+
     template <class T, vector_storage StorageType, VectorOptions tOpts = VectorOptions {}>
     class vector_interface : public StorageType
     {
@@ -181,12 +381,32 @@ export namespace sj
         constexpr vector_interface() = default;
         constexpr vector_interface(const vector_interface& other) = default;
 
+        constexpr vector_interface(const vector_interface& other)
+            requires growable_vector_storage<StorageType>
+            : StorageType(std::allocator_traits<typename StorageType::allocator_type>::
+                              select_on_container_copy_construction(other.get_allocator()))
+        {
+            reserve(other.m_count);
+            for(const T& entry : other)
+            {
+                emplace_back(entry);
+            }
+        }
+
         constexpr vector_interface(vector_interface&& other) noexcept
             : StorageType(std::move(other))
         {
             m_count = std::exchange(other.m_count, 0);
         };
 
+        constexpr vector_interface(vector_interface&& other) noexcept
+            requires growable_vector_storage<StorageType>
+            : StorageType(other.get_allocator())
+        {
+            StorageType::move_from(other, other.m_count);
+            m_count = std::exchange(other.m_count, 0);
+        };
+
         constexpr vector_interface(size_t count, T&& val = T())
         {
             resize(count, std::move(val));
@@ -271,20 +491,45 @@ export namespace sj
 
         constexpr vector_interface& operator=(const vector_interface& other)
         {
+            if(this == &other)
+                return *this;
+
             clear();
 
-            StorageType::operator=(other);
-            m_count = other.m_count;
+            if constexpr(growable_vector_storage<StorageType>)
+            {
+                reserve(other.m_count);
+                for(const T& entry : other)
+                {
+                    emplace_back(entry);
+                }
+            }
+            else
+            {
+                StorageType::operator=(other);
+                m_count = other.m_count;
+            }
 
             return *this;
         }
 
         constexpr vector_interface& operator=(vector_interface&& other) noexcept
         {
+            if(this == &other)
+                return *this;
+
             clear();
 
-            StorageType::operator=(std::forward<vector_interface>(other));
-            m_count = other.m_count;
+            if constexpr(growable_vector_storage<StorageType>)
+            {
+                StorageType::move_from(other, other.m_count);
+                m_count = std::exchange(other.m_count, 0);
+            }
+            else
+            {
+                StorageType::operator=(std::forward<vector_interface>(other));
+                m_count = other.m_count;
+            }
 
             return *this;
         }
@@ -428,10 +673,10 @@ export namespace sj
 
             if(m_count > 0)
             {
-                for(auto it = output_pos + 1; it != end(); ++it)
-                {
-                    new(std::to_address(it - 1)) T(std::move(*it));
-                }
+                // Slide the tail down over the erased element
+                relocate_elements(std::to_address(output_pos),
+                                  std::to_address(output_pos + 1),
+                                  static_cast<size_t>(end() - (output_pos + 1)));
             }
 
             m_count--;
@@ -480,7 +725,7 @@ export namespace sj
         {
             if constexpr(growable_vector_storage<StorageType>)
             {
-                StorageType::reserve(new_capacity);
+                StorageType::reserve(new_capacity, m_count);
             }
             else
             {
@@ -609,4 +854,10 @@ export namespace sj
               VectorOptions tOpts = {},
               class AllocatorType = std::pmr::polymorphic_allocator<T>>
     using dynamic_vector = vector_interface<T, dynamic_vector_storage<T, AllocatorType>, tOpts>;
+
+    template <class T,
+              size_t N,
+              VectorOptions tOpts = {},
+              class AllocatorType = std::pmr::polymorphic_allocator<T>>
+    using small_vector = vector_interface<T, small_vector_storage<T, N, AllocatorType>, tOpts>;
 } // namespace sj
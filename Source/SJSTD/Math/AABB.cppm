@@ -0,0 +1,104 @@
+module;
+
+#include <algorithm>
+
+export module sj.std.math:AABB;
+import :Vec3;
+import :Vec4;
+import :Mat44;
+
+export namespace sj
+{
+    /**
+     * Axis aligned bounding box
+     */
+    struct AABB
+    {
+        [[nodiscard]] constexpr Vec3 GetCenter() const
+        {
+            return {.x = (min.x + max.x) * 0.5f,
+                    .y = (min.y + max.y) * 0.5f,
+                    .z = (min.z + max.z) * 0.5f};
+        }
+
+        /** Half the size of the box along each axis */
+        [[nodiscard]] constexpr Vec3 GetExtents() const
+        {
+            return {.x = (max.x - min.x) * 0.5f,
+                    .y = (max.y - min.y) * 0.5f,
+                    .z = (max.z - min.z) * 0.5f};
+        }
+
+        [[nodiscard]] constexpr float GetSurfaceArea() const
+        {
+            const float dx = max.x - min.x;
+            const float dy = max.y - min.y;
+            const float dz = max.z - min.z;
+            return 2.0f * (dx * dy + dy * dz + dz * dx);
+        }
+
+        [[nodiscard]] constexpr bool Contains(const Vec3& point) const
+        {
+            return point.x >= min.x && point.x <= max.x && point.y >= min.y && point.y <= max.y &&
+                   point.z >= min.z && point.z <= max.z;
+        }
+
+        [[nodiscard]] constexpr bool Contains(const AABB& other) const
+        {
+            return other.min.x >= min.x && other.max.x <= max.x && other.min.y >= min.y &&
+                   other.max.y <= max.y && other.min.z >= min.z && other.max.z <= max.z;
+        }
+
+        [[nodiscard]] constexpr bool Overlaps(const AABB& other) const
+        {
+            return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y &&
+                   max.y >= other.min.y && min.z <= other.max.z && max.z >= other.min.z;
+        }
+
+        /** @return Smallest box enclosing a and b */
+        [[nodiscard]] static constexpr AABB Merge(const AABB& a, const AABB& b)
+        {
+            return {.min = {.x = std::min(a.min.x, b.min.x),
+                            .y = std::min(a.min.y, b.min.y),
+                            .z = std::min(a.min.z, b.min.z)},
+                    .max = {.x = std::max(a.max.x, b.max.x),
+                            .y = std::max(a.max.y, b.max.y),
+                            .z = std::max(a.max.z, b.max.z)}};
+        }
+
+        bool operator==(const AABB& other) const = default;
+
+        Vec3 min;
+        Vec3 max;
+    };
+
+    /**
+     * @return Box enclosing aabb after an affine transform.
+     * Transforms the center and projects the extents onto the transformed axes
+     */
+    [[nodiscard]] constexpr AABB TransformAABB(const AABB& aabb, const Mat44& transform)
+    {
+        const Vec3 center = aabb.GetCenter();
+        const Vec3 extents = aabb.GetExtents();
+
+        const Vec4 newCenter = Vec4(center.x, center.y, center.z, 1.0f) * transform;
+
+        auto projectExtent = [&]<int tCol>() {
+            auto abs = [](float v) { return v < 0.0f ? -v : v; };
+            return abs(transform.Get<0, tCol>()) * extents.x +
+                   abs(transform.Get<1, tCol>()) * extents.y +
+                   abs(transform.Get<2, tCol>()) * extents.z;
+        };
+
+        const Vec3 newExtents = {.x = projectExtent.template operator()<0>(),
+                                 .y = projectExtent.template operator()<1>(),
+                                 .z = projectExtent.template operator()<2>()};
+
+        return {.min = {.x = newCenter.GetX() - newExtents.x,
+                        .y = newCenter.GetY() - newExtents.y,
+                        .z = newCenter.GetZ() - newExtents.z},
+                .max = {.x = newCenter.GetX() + newExtents.x,
+                        .y = newCenter.GetY() + newExtents.y,
+                        .z = newCenter.GetZ() + newExtents.z}};
+    }
+} // namespace sj
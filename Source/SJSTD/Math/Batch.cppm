@@ -0,0 +1,243 @@
+module;
+
+#include <cstddef>
+#include <span>
+
+#include <ScrewjankStd/Assert.hpp>
+#include <ScrewjankStd/PlatformDetection.hpp>
+
+#ifdef SJ_SIMD_AVX2
+    #include <immintrin.h>
+#endif
+
+export module sj.std.math:Batch;
+import :Vec3;
+import :Vec4;
+import :Mat44;
+import :AABB;
+
+#ifdef SJ_SIMD_AVX2
+/**
+ * 8 wide structure-of-arrays helpers. Data stays array-of-structs in memory and is transposed in
+ * registers, so callers keep their existing layouts
+ */
+namespace sj::math_detail
+{
+    static_assert(sizeof(Vec3) == 3 * sizeof(float), "Batch kernels assume packed Vec3");
+    static_assert(sizeof(AABB) == 2 * sizeof(Vec3), "Batch kernels assume packed AABB");
+
+    struct Vec3x8
+    {
+        __m256 x;
+        __m256 y;
+        __m256 z;
+    };
+
+    /** Transposes 8 consecutive Vec3s (24 floats) into one register per component */
+    inline Vec3x8 LoadVec3x8(const float* src)
+    {
+        const __m256 m03 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 0)),
+                                                _mm_loadu_ps(src + 12),
+                                                1);
+        const __m256 m14 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 4)),
+                                                _mm_loadu_ps(src + 16),
+                                                1);
+        const __m256 m25 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src + 8)),
+                                                _mm_loadu_ps(src + 20),
+                                                1);
+
+        const __m256 xy = _mm256_shuffle_ps(m14, m25, _MM_SHUFFLE(2, 1, 3, 2));
+        const __m256 yz = _mm256_shuffle_ps(m03, m14, _MM_SHUFFLE(1, 0, 2, 1));
+
+        return {.x = _mm256_shuffle_ps(m03, xy, _MM_SHUFFLE(2, 0, 3, 0)),
+                .y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0)),
+                .z = _mm256_shuffle_ps(yz, m25, _MM_SHUFFLE(3, 0, 3, 1))};
+    }
+
+    /** Inverse of LoadVec3x8 */
+    inline void StoreVec3x8(float* dst, const Vec3x8& v)
+    {
+        const __m256 xy = _mm256_shuffle_ps(v.x, v.y, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 yz = _mm256_shuffle_ps(v.y, v.z, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m256 zx = _mm256_shuffle_ps(v.z, v.x, _MM_SHUFFLE(3, 1, 2, 0));
+
+        const __m256 m03 = _mm256_shuffle_ps(xy, zx, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 m14 = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+        const __m256 m25 = _mm256_shuffle_ps(zx, yz, _MM_SHUFFLE(3, 1, 3, 1));
+
+        _mm_storeu_ps(dst + 0, _mm256_castps256_ps128(m03));
+        _mm_storeu_ps(dst + 4, _mm256_castps256_ps128(m14));
+        _mm_storeu_ps(dst + 8, _mm256_castps256_ps128(m25));
+        _mm_storeu_ps(dst + 12, _mm256_extractf128_ps(m03, 1));
+        _mm_storeu_ps(dst + 16, _mm256_extractf128_ps(m14, 1));
+        _mm_storeu_ps(dst + 20, _mm256_extractf128_ps(m25, 1));
+    }
+
+    /** Affine transform of 8 points by m, whose entries are pre-broadcast */
+    struct Mat44x8
+    {
+        explicit Mat44x8(const Mat44& m)
+        {
+            for(int row = 0; row < 4; row++)
+            {
+                for(int col = 0; col < 4; col++)
+                    e[row][col] = _mm256_set1_ps(m.Data()[row].Data()[col]);
+            }
+        }
+
+        [[nodiscard]] Vec3x8 TransformPoints(const Vec3x8& p) const
+        {
+            auto column = [&](int col) {
+                __m256 result = _mm256_fmadd_ps(p.x, e[0][col], e[3][col]);
+                result = _mm256_fmadd_ps(p.y, e[1][col], result);
+                return _mm256_fmadd_ps(p.z, e[2][col], result);
+            };
+
+            return {.x = column(0), .y = column(1), .z = column(2)};
+        }
+
+        /** Projects extents onto the transformed axes, like TransformAABB */
+        [[nodiscard]] Vec3x8 TransformExtents(const Vec3x8& extents) const
+        {
+            const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+
+            auto column = [&](int col) {
+                __m256 result = _mm256_mul_ps(extents.x, _mm256_and_ps(e[0][col], absMask));
+                result = _mm256_fmadd_ps(extents.y, _mm256_and_ps(e[1][col], absMask), result);
+                return _mm256_fmadd_ps(extents.z, _mm256_and_ps(e[2][col], absMask), result);
+            };
+
+            return {.x = column(0), .y = column(1), .z = column(2)};
+        }
+
+        __m256 e[4][4];
+    };
+} // namespace sj::math_detail
+#endif
+
+export namespace sj
+{
+    /**
+     * out[i] = points[i] * transform, treating each point as having w = 1.
+     * Affine transforms only, w is not divided out. out may be the same span as points
+     */
+    inline void TransformPoints(std::span<const Vec3> points,
+                                const Mat44& transform,
+                                std::span<Vec3> out)
+    {
+        SJ_ASSERT(out.size() >= points.size(), "Output span is too small");
+
+        size_t i = 0;
+
+#ifdef SJ_SIMD_AVX2
+        const math_detail::Mat44x8 wideTransform(transform);
+        for(; i + 8 <= points.size(); i += 8)
+        {
+            const math_detail::Vec3x8 p = math_detail::LoadVec3x8(&points[i].x);
+            math_detail::StoreVec3x8(&out[i].x, wideTransform.TransformPoints(p));
+        }
+#endif
+
+        for(; i < points.size(); i++)
+        {
+            const Vec3& p = points[i];
+            const Vec4 result = Vec4(p.x, p.y, p.z, 1.0f) * transform;
+            out[i] = {.x = result.GetX(), .y = result.GetY(), .z = result.GetZ()};
+        }
+    }
+
+    /**
+     * out[i] = lhs[i] * rhs[i]
+     */
+    inline void MultiplyMatrices(std::span<const Mat44> lhs,
+                                 std::span<const Mat44> rhs,
+                                 std::span<Mat44> out)
+    {
+        SJ_ASSERT(lhs.size() == rhs.size(), "Matrix spans must be the same size");
+        SJ_ASSERT(out.size() >= lhs.size(), "Output span is too small");
+
+        for(size_t i = 0; i < lhs.size(); i++)
+            out[i] = lhs[i] * rhs[i];
+    }
+
+    /**
+     * out[i] = lhs[i] * rhs. e.g. moving many local transforms into their shared parent's space
+     */
+    inline void MultiplyMatrices(std::span<const Mat44> lhs, const Mat44& rhs, std::span<Mat44> out)
+    {
+        SJ_ASSERT(out.size() >= lhs.size(), "Output span is too small");
+
+        for(size_t i = 0; i < lhs.size(); i++)
+            out[i] = lhs[i] * rhs;
+    }
+
+    /**
+     * out[i] = TransformAABB(boxes[i], transform). out may be the same span as boxes
+     */
+    inline void TransformAABBs(std::span<const AABB> boxes,
+                               const Mat44& transform,
+                               std::span<AABB> out)
+    {
+        SJ_ASSERT(out.size() >= boxes.size(), "Output span is too small");
+
+        size_t i = 0;
+
+#ifdef SJ_SIMD_AVX2
+        const math_detail::Mat44x8 wideTransform(transform);
+        const __m256 half = _mm256_set1_ps(0.5f);
+
+        for(; i + 8 <= boxes.size(); i += 8)
+        {
+            // Each load covers 4 boxes as alternating min/max points. Splitting even and odd lanes
+            // gives 8 mins and 8 maxes in a shuffled box order that the store undoes
+            const math_detail::Vec3x8 lo = math_detail::LoadVec3x8(&boxes[i].min.x);
+            const math_detail::Vec3x8 hi = math_detail::LoadVec3x8(&boxes[i + 4].min.x);
+
+            auto evens = [](__m256 a, __m256 b) {
+                return _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            };
+            auto odds = [](__m256 a, __m256 b) {
+                return _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            };
+
+            const math_detail::Vec3x8 mins = {.x = evens(lo.x, hi.x),
+                                              .y = evens(lo.y, hi.y),
+                                              .z = evens(lo.z, hi.z)};
+            const math_detail::Vec3x8 maxes = {.x = odds(lo.x, hi.x),
+                                               .y = odds(lo.y, hi.y),
+                                               .z = odds(lo.z, hi.z)};
+
+            const math_detail::Vec3x8 centers = {
+                .x = _mm256_mul_ps(_mm256_add_ps(mins.x, maxes.x), half),
+                .y = _mm256_mul_ps(_mm256_add_ps(mins.y, maxes.y), half),
+                .z = _mm256_mul_ps(_mm256_add_ps(mins.z, maxes.z), half)};
+            const math_detail::Vec3x8 extents = {
+                .x = _mm256_mul_ps(_mm256_sub_ps(maxes.x, mins.x), half),
+                .y = _mm256_mul_ps(_mm256_sub_ps(maxes.y, mins.y), half),
+                .z = _mm256_mul_ps(_mm256_sub_ps(maxes.z, mins.z), half)};
+
+            const math_detail::Vec3x8 newCenters = wideTransform.TransformPoints(centers);
+            const math_detail::Vec3x8 newExtents = wideTransform.TransformExtents(extents);
+
+            const math_detail::Vec3x8 newMins = {.x = _mm256_sub_ps(newCenters.x, newExtents.x),
+                                                 .y = _mm256_sub_ps(newCenters.y, newExtents.y),
+                                                 .z = _mm256_sub_ps(newCenters.z, newExtents.z)};
+            const math_detail::Vec3x8 newMaxes = {.x = _mm256_add_ps(newCenters.x, newExtents.x),
+                                                  .y = _mm256_add_ps(newCenters.y, newExtents.y),
+                                                  .z = _mm256_add_ps(newCenters.z, newExtents.z)};
+
+            math_detail::StoreVec3x8(&out[i].min.x,
+                                     {.x = _mm256_unpacklo_ps(newMins.x, newMaxes.x),
+                                      .y = _mm256_unpacklo_ps(newMins.y, newMaxes.y),
+                                      .z = _mm256_unpacklo_ps(newMins.z, newMaxes.z)});
+            math_detail::StoreVec3x8(&out[i + 4].min.x,
+                                     {.x = _mm256_unpackhi_ps(newMins.x, newMaxes.x),
+                                      .y = _mm256_unpackhi_ps(newMins.y, newMaxes.y),
+                                      .z = _mm256_unpackhi_ps(newMins.z, newMaxes.z)});
+        }
+#endif
+
+        for(; i < boxes.size(); i++)
+            out[i] = TransformAABB(boxes[i], transform);
+    }
+} // namespace sj
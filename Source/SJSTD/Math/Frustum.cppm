@@ -0,0 +1,186 @@
+module;
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <ScrewjankStd/Assert.hpp>
+#include <ScrewjankStd/PlatformDetection.hpp>
+
+#ifdef SJ_SIMD_AVX2
+    #include <immintrin.h>
+#endif
+
+export module sj.std.math:Frustum;
+import :Vec3;
+import :Vec4;
+import :Mat44;
+import :AABB;
+import :Batch;
+
+export namespace sj
+{
+    /**
+     * Six inward facing planes stored as (normal, distance): a point p is inside a plane when
+     * dot(normal, p) + distance >= 0
+     */
+    struct Frustum
+    {
+        /**
+         * Extracts the planes of a row vector view-projection matrix (Gribb-Hartmann).
+         * Assumes clip space depth in [0, w], which holds for both standard and reversed Z
+         * @note Planes are normalized, so plane distances are in world units
+         */
+        [[nodiscard]] static Frustum FromViewProjection(const Mat44& viewProjection)
+        {
+            const Vec4 x = viewProjection.GetCol<0>();
+            const Vec4 y = viewProjection.GetCol<1>();
+            const Vec4 z = viewProjection.GetCol<2>();
+            const Vec4 w = viewProjection.GetCol<3>();
+
+            Frustum frustum {.planes = {w + x, w - x, w + y, w - y, z, w - z}};
+            for(Vec4& plane : frustum.planes)
+            {
+                const float invLength =
+                    1.0f / std::sqrt(plane.GetX() * plane.GetX() + plane.GetY() * plane.GetY() +
+                                     plane.GetZ() * plane.GetZ());
+                plane *= invLength;
+            }
+
+            return frustum;
+        }
+
+        /**
+         * Conservative: a box outside the frustum but straddling two planes near a corner passes
+         */
+        [[nodiscard]] constexpr bool Intersects(const AABB& aabb) const
+        {
+            const Vec3 center = aabb.GetCenter();
+            const Vec3 extents = aabb.GetExtents();
+
+            auto abs = [](float v) { return v < 0.0f ? -v : v; };
+
+            for(const Vec4& plane : planes)
+            {
+                const float distance = plane.GetX() * center.x + plane.GetY() * center.y +
+                                       plane.GetZ() * center.z + plane.GetW();
+                const float radius = abs(plane.GetX()) * extents.x +
+                                     abs(plane.GetY()) * extents.y +
+                                     abs(plane.GetZ()) * extents.z;
+
+                if(distance + radius < 0.0f)
+                    return false;
+            }
+
+            return true;
+        }
+
+        /** Left, right, bottom, top, near, far */
+        std::array<Vec4, 6> planes;
+    };
+
+    /**
+     * Writes the index of every box that intersects frustum to outVisibleIndices, in ascending
+     * order. Same test as Frustum::Intersects, 8 boxes at a time where available
+     * @return Number of indices written
+     */
+    inline size_t CullAABBs(const Frustum& frustum,
+                            std::span<const AABB> boxes,
+                            std::span<uint32_t> outVisibleIndices)
+    {
+        SJ_ASSERT(outVisibleIndices.size() >= boxes.size(), "Output span is too small");
+
+        size_t numVisible = 0;
+        size_t i = 0;
+
+#ifdef SJ_SIMD_AVX2
+        const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+        const __m256 half = _mm256_set1_ps(0.5f);
+        const __m256 zero = _mm256_setzero_ps();
+
+        struct WidePlane
+        {
+            __m256 x, y, z, w;
+            __m256 absX, absY, absZ;
+        };
+
+        std::array<WidePlane, 6> widePlanes;
+        for(size_t p = 0; p < widePlanes.size(); p++)
+        {
+            const Vec4& plane = frustum.planes[p];
+            WidePlane& wide = widePlanes[p];
+            wide.x = _mm256_set1_ps(plane.GetX());
+            wide.y = _mm256_set1_ps(plane.GetY());
+            wide.z = _mm256_set1_ps(plane.GetZ());
+            wide.w = _mm256_set1_ps(plane.GetW());
+            wide.absX = _mm256_and_ps(wide.x, absMask);
+            wide.absY = _mm256_and_ps(wide.y, absMask);
+            wide.absZ = _mm256_and_ps(wide.z, absMask);
+        }
+
+        for(; i + 8 <= boxes.size(); i += 8)
+        {
+            // Same even/odd split as TransformAABBs. Lanes hold boxes 0 1 4 5 2 3 6 7
+            const math_detail::Vec3x8 lo = math_detail::LoadVec3x8(&boxes[i].min.x);
+            const math_detail::Vec3x8 hi = math_detail::LoadVec3x8(&boxes[i + 4].min.x);
+
+            auto evens = [](__m256 a, __m256 b) {
+                return _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+            };
+            auto odds = [](__m256 a, __m256 b) {
+                return _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+            };
+
+            const __m256 minX = evens(lo.x, hi.x), maxX = odds(lo.x, hi.x);
+            const __m256 minY = evens(lo.y, hi.y), maxY = odds(lo.y, hi.y);
+            const __m256 minZ = evens(lo.z, hi.z), maxZ = odds(lo.z, hi.z);
+
+            const __m256 centerX = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+            const __m256 centerY = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+            const __m256 centerZ = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+            const __m256 extentX = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+            const __m256 extentY = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+            const __m256 extentZ = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+            __m256 outside = zero;
+            for(const WidePlane& plane : widePlanes)
+            {
+                __m256 distance = _mm256_fmadd_ps(centerX, plane.x, plane.w);
+                distance = _mm256_fmadd_ps(centerY, plane.y, distance);
+                distance = _mm256_fmadd_ps(centerZ, plane.z, distance);
+
+                __m256 radius = _mm256_mul_ps(extentX, plane.absX);
+                radius = _mm256_fmadd_ps(extentY, plane.absY, radius);
+                radius = _mm256_fmadd_ps(extentZ, plane.absZ, radius);
+
+                outside = _mm256_or_ps(
+                    outside,
+                    _mm256_cmp_ps(_mm256_add_ps(distance, radius), zero, _CMP_LT_OQ));
+            }
+
+            // Swap the middle lane pairs back so bit n is box i + n
+            const uint32_t laneMask = ~static_cast<uint32_t>(_mm256_movemask_ps(outside)) & 0xFF;
+            uint32_t boxMask = (laneMask & 0xC3) | ((laneMask & 0x30) >> 2) |
+                               ((laneMask & 0x0C) << 2);
+
+            while(boxMask != 0)
+            {
+                outVisibleIndices[numVisible++] =
+                    static_cast<uint32_t>(i) + static_cast<uint32_t>(std::countr_zero(boxMask));
+                boxMask &= boxMask - 1;
+            }
+        }
+#endif
+
+        for(; i < boxes.size(); i++)
+        {
+            if(frustum.Intersects(boxes[i]))
+                outVisibleIndices[numVisible++] = static_cast<uint32_t>(i);
+        }
+
+        return numVisible;
+    }
+} // namespace sj
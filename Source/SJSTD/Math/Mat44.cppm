@@ -3,6 +3,13 @@ module;
 #include <cmath>
 #include <numbers>
 #include <array>
+#include <type_traits>
+
+#include <ScrewjankStd/PlatformDetection.hpp>
+
+#ifdef SJ_SIMD_SSE41
+    #include <immintrin.h>
+#endif
 
 export module sj.std.math:Mat44;
 import :Vec3;
@@ -115,21 +122,48 @@ export namespace sj
             return *this;
         }
 
-        [[nodiscard]] auto AffineInverse() const -> Mat44
+        /**
+         * Inverse of a matrix made of a scale, a rotation and a translation.
+         * The rotation's inverse is its transpose, and dividing each axis by its squared length
+         * removes the scale, so no square roots are needed
+         */
+        [[nodiscard]] constexpr auto AffineInverse() const -> Mat44
         {
-            const float invScaleX = 1.0f / GetX().Magnitude();
-            const float invScaleY = 1.0f / GetY().Magnitude();
-            const float invScaleZ = 1.0f / GetZ().Magnitude();
+#ifdef SJ_SIMD_SSE41
+            if(!std::is_constant_evaluated())
+            {
+                const __m128 x = m_rows[0].ToSimd();
+                const __m128 y = m_rows[1].ToSimd();
+                const __m128 z = m_rows[2].ToSimd();
+                const __m128 w = m_rows[3].ToSimd();
+
+                __m128 invX = _mm_div_ps(x, math_detail::Dot4(x, x));
+                __m128 invY = _mm_div_ps(y, math_detail::Dot4(y, y));
+                __m128 invZ = _mm_div_ps(z, math_detail::Dot4(z, z));
+                __m128 discard = _mm_setzero_ps();
+                _MM_TRANSPOSE4_PS(invX, invY, invZ, discard);
+
+                __m128 inverseT = _mm_mul_ps(math_detail::Splat<0>(w), invX);
+                inverseT = math_detail::MulAdd(math_detail::Splat<1>(w), invY, inverseT);
+                inverseT = math_detail::MulAdd(math_detail::Splat<2>(w), invZ, inverseT);
+                inverseT = _mm_xor_ps(inverseT, _mm_set1_ps(-0.0f));
+                inverseT = _mm_insert_ps(inverseT, _mm_set_ss(1.0f), _MM_MK_INSERTPS_NDX(0, 3, 0));
+
+                return {Vec4::FromSimd(invX),
+                        Vec4::FromSimd(invY),
+                        Vec4::FromSimd(invZ),
+                        Vec4::FromSimd(inverseT)};
+            }
+#endif
 
-            const Vec4 unitX = GetX() * invScaleX;
-            const Vec4 unitY = GetY() * invScaleY;
-            const Vec4 unitZ = GetZ() * invScaleZ;
+            const Vec4 invX = GetX() / GetX().MagnitudeSqr();
+            const Vec4 invY = GetY() / GetY().MagnitudeSqr();
+            const Vec4 invZ = GetZ() / GetZ().MagnitudeSqr();
 
-            Mat44 inverseRot {
-                {unitX.GetX() * invScaleX, unitY.GetX() * invScaleX, unitZ.GetX() * invScaleX, 0},
-                {unitX.GetY() * invScaleY, unitY.GetY() * invScaleY, unitZ.GetY() * invScaleY, 0},
-                {unitX.GetZ() * invScaleZ, unitY.GetZ() * invScaleZ, unitZ.GetZ() * invScaleZ, 0},
-                {0.0f, 0.0f, 0.0f, 1}};
+            Mat44 inverseRot {{invX.GetX(), invY.GetX(), invZ.GetX(), 0},
+                              {invX.GetY(), invY.GetY(), invZ.GetY(), 0},
+                              {invX.GetZ(), invY.GetZ(), invZ.GetZ(), 0},
+                              {0.0f, 0.0f, 0.0f, 1}};
 
             Vec4 inverseT = (-GetW()) * inverseRot;
             inverseT.SetW(1.0f);
@@ -226,6 +260,20 @@ export namespace sj
 
     constexpr Vec4 operator*(const Vec4& v, const Mat44& m)
     {
+#ifdef SJ_SIMD_SSE41
+        if(!std::is_constant_evaluated())
+        {
+            const __m128 vec = v.ToSimd();
+
+            __m128 result = _mm_mul_ps(math_detail::Splat<0>(vec), m.GetX().ToSimd());
+            result = math_detail::MulAdd(math_detail::Splat<1>(vec), m.GetY().ToSimd(), result);
+            result = math_detail::MulAdd(math_detail::Splat<2>(vec), m.GetZ().ToSimd(), result);
+            result = math_detail::MulAdd(math_detail::Splat<3>(vec), m.GetW().ToSimd(), result);
+
+            return Vec4::FromSimd(result);
+        }
+#endif
+
         float xPrime = (v.GetX() * m.Get<0, 0>()) + (v.GetY() * m.Get<1, 0>()) +
                        (v.GetZ() * m.Get<2, 0>()) + (v.GetW() * m.Get<3, 0>());
         float yPrime = (v.GetX() * m.Get<0, 1>()) + (v.GetY() * m.Get<1, 1>()) +
@@ -240,6 +288,39 @@ export namespace sj
 
     constexpr Mat44 operator*(const Mat44& a, const Mat44& b)
     {
+#if defined(SJ_SIMD_AVX2)
+        if(!std::is_constant_evaluated())
+        {
+            // Two rows of a per iteration, one in each 128 bit half
+            const float* bRows = b.Data()[0].Data().data();
+            const __m256 bX = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(bRows + 0));
+            const __m256 bY = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(bRows + 4));
+            const __m256 bZ = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(bRows + 8));
+            const __m256 bW = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(bRows + 12));
+
+            Mat44 result;
+            const float* aRows = a.Data()[0].Data().data();
+            float* outRows = result.Data()[0].Data().data();
+
+            for(int row = 0; row < 4; row += 2)
+            {
+                const __m256 aRow = _mm256_loadu_ps(aRows + row * 4);
+
+                __m256 out = _mm256_mul_ps(_mm256_shuffle_ps(aRow, aRow, 0x00), bX);
+                out = _mm256_fmadd_ps(_mm256_shuffle_ps(aRow, aRow, 0x55), bY, out);
+                out = _mm256_fmadd_ps(_mm256_shuffle_ps(aRow, aRow, 0xAA), bZ, out);
+                out = _mm256_fmadd_ps(_mm256_shuffle_ps(aRow, aRow, 0xFF), bW, out);
+
+                _mm256_storeu_ps(outRows + row * 4, out);
+            }
+
+            return result;
+        }
+#elif defined(SJ_SIMD_SSE41)
+        if(!std::is_constant_evaluated())
+            return {a.GetX() * b, a.GetY() * b, a.GetZ() * b, a.GetW() * b};
+#endif
+
         const Vec4 aX = a.GetX();
         const Vec4 aY = a.GetY();
         const Vec4 aZ = a.GetZ();
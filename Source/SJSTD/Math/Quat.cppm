@@ -1,8 +1,17 @@
 module;
 
 #include <array>
+#include <cmath>
+#include <type_traits>
+
+#include <ScrewjankStd/PlatformDetection.hpp>
+
+#ifdef SJ_SIMD_SSE41
+    #include <immintrin.h>
+#endif
 
 export module sj.std.math:Quat;
+import :Vec3;
 import :Vec4;
 import :Tags;
 
@@ -11,23 +20,155 @@ export namespace sj
     class alignas(16) Quat
     {
     public:
-        Quat() = default;
-        Quat(IdentityTagT _) : m_elements {0.0f, 0.0f, 0.0f, 1.0f}
+        constexpr Quat() = default;
+        constexpr Quat(IdentityTagT _) : m_elements {0.0f, 0.0f, 0.0f, 1.0f}
         {
         }
-        Quat(float x, float y, float z, float w) : m_elements {x, y, z, w}
+        constexpr Quat(float x, float y, float z, float w) : m_elements {x, y, z, w}
         {
         }
-        Quat(const Vec4& v) : m_elements( v.Data() )
+        constexpr Quat(const Vec4& v) : m_elements {v.GetX(), v.GetY(), v.GetZ(), v.GetW()}
         {
         }
 
-        auto&& operator[](this auto&& self, int idx) // -> float& or const float&
+        constexpr auto&& operator[](this auto&& self, int idx) // -> float& or const float&
         {
             return self.m_elements[idx];
         }
 
+        /**
+         * @param axis Unit length axis, w is ignored
+         * @param angle Radians, counter clockwise looking down the axis
+         */
+        [[nodiscard]] static Quat FromAxisAngle(const Vec4& axis, float angle)
+        {
+            const float halfSin = std::sin(angle * 0.5f);
+            return {axis.GetX() * halfSin,
+                    axis.GetY() * halfSin,
+                    axis.GetZ() * halfSin,
+                    std::cos(angle * 0.5f)};
+        }
+
+        /**
+         * Same rotation as Mat44::FromEulerXYZ: about x, then y, then z
+         */
+        [[nodiscard]] static Quat FromEulerXYZ(const Vec3& eulers);
+
+        [[nodiscard]] constexpr Vec4 AsVec4() const
+        {
+            return {m_elements[0], m_elements[1], m_elements[2], m_elements[3]};
+        }
+
+        [[nodiscard]] constexpr float Dot(const Quat& other) const
+        {
+            return AsVec4().Dot(other.AsVec4());
+        }
+
+        /** Inverse rotation of a unit quaternion */
+        [[nodiscard]] constexpr Quat Conjugate() const
+        {
+            return {-m_elements[0], -m_elements[1], -m_elements[2], m_elements[3]};
+        }
+
+        [[nodiscard]] Quat Normalize() const
+        {
+            return Quat(AsVec4().Normalize());
+        }
+
+        /**
+         * Rotates v by this unit quaternion. w passes through unchanged
+         */
+        [[nodiscard]] constexpr Vec4 Rotate(const Vec4& v) const
+        {
+            // v + 2w(u x v) + 2u x (u x v), with u the vector part
+            const Vec4 u(m_elements[0], m_elements[1], m_elements[2], 0.0f);
+            const Vec4 v3(v.GetX(), v.GetY(), v.GetZ(), 0.0f);
+
+            const Vec4 t = u.Cross(v3) * 2.0f;
+            Vec4 result = v3 + t * m_elements[3] + u.Cross(t);
+            result.SetW(v.GetW());
+
+            return result;
+        }
+
     private:
-        std::array<float, 4> m_elements;
+        std::array<float, 4> m_elements = {};
     };
-} // namespace sj
\ No newline at end of file
+
+    /**
+     * Hamilton product. Rotating by a * b is the same as rotating by b, then by a
+     */
+    [[nodiscard]] constexpr Quat operator*(const Quat& a, const Quat& b)
+    {
+#ifdef SJ_SIMD_SSE41
+        if(!std::is_constant_evaluated())
+        {
+            const __m128 lhs = a.AsVec4().ToSimd();
+            const __m128 rhs = b.AsVec4().ToSimd();
+
+            // Each term is one lane of a times a permutation of b with per-lane signs
+            const __m128 wzyx = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(0, 1, 2, 3));
+            const __m128 zwxy = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 0, 3, 2));
+            const __m128 yxwz = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(2, 3, 0, 1));
+
+            const __m128 xTerm = _mm_xor_ps(wzyx, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+            const __m128 yTerm = _mm_xor_ps(zwxy, _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f));
+            const __m128 zTerm = _mm_xor_ps(yxwz, _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+            __m128 result = _mm_mul_ps(math_detail::Splat<3>(lhs), rhs);
+            result = math_detail::MulAdd(math_detail::Splat<0>(lhs), xTerm, result);
+            result = math_detail::MulAdd(math_detail::Splat<1>(lhs), yTerm, result);
+            result = math_detail::MulAdd(math_detail::Splat<2>(lhs), zTerm, result);
+
+            return Quat(Vec4::FromSimd(result));
+        }
+#endif
+
+        const float ax = a[0], ay = a[1], az = a[2], aw = a[3];
+        const float bx = b[0], by = b[1], bz = b[2], bw = b[3];
+
+        return {aw * bx + ax * bw + ay * bz - az * by,
+                aw * by - ax * bz + ay * bw + az * bx,
+                aw * bz + ax * by - ay * bx + az * bw,
+                aw * bw - ax * bx - ay * by - az * bz};
+    }
+
+    inline Quat Quat::FromEulerXYZ(const Vec3& eulers)
+    {
+        const Quat x = FromAxisAngle(Vec4_UnitX, eulers.x);
+        const Quat y = FromAxisAngle(Vec4_UnitY, eulers.y);
+        const Quat z = FromAxisAngle(Vec4_UnitZ, eulers.z);
+
+        return z * y * x;
+    }
+
+    /**
+     * Spherical interpolation between unit quaternions along the shortest arc.
+     * Falls back to a normalized lerp when a and b are nearly parallel
+     */
+    [[nodiscard]] inline Quat Slerp(const Quat& a, const Quat& b, float t)
+    {
+        constexpr float kLerpThreshold = 0.9995f;
+
+        Vec4 to = b.AsVec4();
+        float cosTheta = a.Dot(b);
+
+        // q and -q are the same rotation, take the short way around
+        if(cosTheta < 0.0f)
+        {
+            to = -to;
+            cosTheta = -cosTheta;
+        }
+
+        const Vec4 from = a.AsVec4();
+        if(cosTheta > kLerpThreshold)
+            return Quat((from + (to - from) * t).Normalize());
+
+        const float theta = std::acos(cosTheta);
+        const float invSinTheta = 1.0f / std::sin(theta);
+        const float fromWeight = std::sin((1.0f - t) * theta) * invSinTheta;
+        const float toWeight = std::sin(t * theta) * invSinTheta;
+
+        return Quat(from * fromWeight + to * toWeight);
+    }
+} // namespace sj
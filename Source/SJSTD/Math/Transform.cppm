@@ -0,0 +1,128 @@
+export module sj.std.math:Transform;
+import :Vec3;
+import :Vec4;
+import :Mat44;
+import :Quat;
+import :Tags;
+
+export namespace sj
+{
+    /**
+     * @return Row vector rotation matrix for a unit quaternion, the same convention as Mat44
+     */
+    [[nodiscard]] constexpr Mat44 RotationMatrix(const Quat& q)
+    {
+        const float x = q[0], y = q[1], z = q[2], w = q[3];
+        const float xx = x * x, yy = y * y, zz = z * z;
+        const float xy = x * y, xz = x * z, yz = y * z;
+        const float wx = w * x, wy = w * y, wz = w * z;
+
+        return {{1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f},
+                {2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f},
+                {2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f},
+                {0.0f, 0.0f, 0.0f, 1.0f}};
+    }
+
+    /**
+     * Scale, then rotation, then translation. The decomposed form of BuildTransform.
+     * Composing and inverting skip the 4x4 math, and the result only becomes a Mat44 when a
+     * matrix is actually needed (e.g. GPU upload).
+     * Composition and inversion are exact while scale is uniform. A non-uniform scale under a
+     * rotation produces shear, which TRS can't represent; use Mat44 for those
+     */
+    struct Transform
+    {
+        [[nodiscard]] static Transform FromEulerXYZ(const Vec3& translation,
+                                                    const Vec3& eulers,
+                                                    const Vec3& scale = {1.0f, 1.0f, 1.0f})
+        {
+            return {.translation = translation,
+                    .rotation = Quat::FromEulerXYZ(eulers),
+                    .scale = scale};
+        }
+
+        [[nodiscard]] constexpr Vec3 TransformPoint(const Vec3& point) const
+        {
+            const Vec4 rotated = rotation.Rotate(
+                Vec4(point.x * scale.x, point.y * scale.y, point.z * scale.z, 0.0f));
+
+            return {.x = rotated.GetX() + translation.x,
+                    .y = rotated.GetY() + translation.y,
+                    .z = rotated.GetZ() + translation.z};
+        }
+
+        /** Scales and rotates v without translating it */
+        [[nodiscard]] constexpr Vec3 TransformVector(const Vec3& v) const
+        {
+            const Vec4 rotated =
+                rotation.Rotate(Vec4(v.x * scale.x, v.y * scale.y, v.z * scale.z, 0.0f));
+
+            return {.x = rotated.GetX(), .y = rotated.GetY(), .z = rotated.GetZ()};
+        }
+
+        /**
+         * Conjugated rotation and reciprocal scale, no matrix inversion needed
+         */
+        [[nodiscard]] constexpr Transform Inverse() const
+        {
+            const Quat inverseRotation = rotation.Conjugate();
+            const Vec3 inverseScale = {.x = 1.0f / scale.x,
+                                       .y = 1.0f / scale.y,
+                                       .z = 1.0f / scale.z};
+
+            const Vec4 t =
+                inverseRotation.Rotate(Vec4(-translation.x, -translation.y, -translation.z, 0.0f));
+
+            return {.translation = {.x = t.GetX() * inverseScale.x,
+                                    .y = t.GetY() * inverseScale.y,
+                                    .z = t.GetZ() * inverseScale.z},
+                    .rotation = inverseRotation,
+                    .scale = inverseScale};
+        }
+
+        /**
+         * Same matrix BuildTransform produces for these components
+         */
+        [[nodiscard]] constexpr Mat44 ToMat44() const
+        {
+            const Mat44 r = RotationMatrix(rotation);
+
+            return {r.GetX() * scale.x,
+                    r.GetY() * scale.y,
+                    r.GetZ() * scale.z,
+                    Vec4(translation.x, translation.y, translation.z, 1.0f)};
+        }
+
+        Vec3 translation = {0.0f, 0.0f, 0.0f};
+        Quat rotation = Quat(kIdentityTag);
+        Vec3 scale = {1.0f, 1.0f, 1.0f};
+    };
+
+    /**
+     * Applies a, then b. Matches Mat44 composition: (a * b).ToMat44() == a.ToMat44() * b.ToMat44()
+     */
+    [[nodiscard]] constexpr Transform operator*(const Transform& a, const Transform& b)
+    {
+        return {.translation = b.TransformPoint(a.translation),
+                .rotation = b.rotation * a.rotation,
+                .scale = {.x = a.scale.x * b.scale.x,
+                          .y = a.scale.y * b.scale.y,
+                          .z = a.scale.z * b.scale.z}};
+    }
+
+    /**
+     * Lerps translation and scale, slerps rotation
+     */
+    [[nodiscard]] inline Transform Interpolate(const Transform& a, const Transform& b, float t)
+    {
+        auto lerp = [t](const Vec3& from, const Vec3& to) -> Vec3 {
+            return {.x = from.x + (to.x - from.x) * t,
+                    .y = from.y + (to.y - from.y) * t,
+                    .z = from.z + (to.z - from.z) * t};
+        };
+
+        return {.translation = lerp(a.translation, b.translation),
+                .rotation = Slerp(a.rotation, b.rotation, t),
+                .scale = lerp(a.scale, b.scale)};
+    }
+} // namespace sj
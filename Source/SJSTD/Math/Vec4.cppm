@@ -2,11 +2,58 @@ module;
 
 #include <cmath>
 #include <array>
+#include <type_traits>
+
+#include <ScrewjankStd/PlatformDetection.hpp>
+
+#ifdef SJ_SIMD_SSE41
+    #include <immintrin.h>
+#endif
 
 export module sj.std.math:Vec4;
 import :Vec2;
 import :Vec3;
 
+#ifdef SJ_SIMD_SSE41
+/**
+ * Register helpers shared by the math types. Only used outside constant evaluation
+ */
+namespace sj::math_detail
+{
+    inline __m128 Load(const std::array<float, 4>& v)
+    {
+        return _mm_load_ps(v.data());
+    }
+
+    inline void Store(std::array<float, 4>& v, __m128 value)
+    {
+        _mm_store_ps(v.data(), value);
+    }
+
+    /** a * b + c */
+    inline __m128 MulAdd(__m128 a, __m128 b, __m128 c)
+    {
+    #ifdef SJ_SIMD_AVX2
+        return _mm_fmadd_ps(a, b, c);
+    #else
+        return _mm_add_ps(_mm_mul_ps(a, b), c);
+    #endif
+    }
+
+    /** Dot product of a and b broadcast to every lane */
+    inline __m128 Dot4(__m128 a, __m128 b)
+    {
+        return _mm_dp_ps(a, b, 0xFF);
+    }
+
+    template <int tLane>
+    inline __m128 Splat(__m128 v)
+    {
+        return _mm_shuffle_ps(v, v, _MM_SHUFFLE(tLane, tLane, tLane, tLane));
+    }
+} // namespace sj::math_detail
+#endif
+
 export namespace sj
 {
     // Forward Declares
@@ -50,6 +97,16 @@ export namespace sj
 
         constexpr Vec4& operator+=(const Vec4& other)
         {
+#ifdef SJ_SIMD_SSE41
+            if(!std::is_constant_evaluated())
+            {
+                math_detail::Store(m_elements,
+                                   _mm_add_ps(math_detail::Load(m_elements),
+                                              math_detail::Load(other.m_elements)));
+                return *this;
+            }
+#endif
+
             m_elements[0] += other.m_elements[0];
             m_elements[1] += other.m_elements[1];
             m_elements[2] += other.m_elements[2];
@@ -60,11 +117,24 @@ export namespace sj
 
         [[nodiscard]] constexpr Vec4 operator/(const float s) const
         {
+#ifdef SJ_SIMD_SSE41
+            if(!std::is_constant_evaluated())
+                return FromSimd(_mm_div_ps(math_detail::Load(m_elements), _mm_set1_ps(s)));
+#endif
+
             return {m_elements[0] / s, m_elements[1] / s, m_elements[2] / s, m_elements[3] / s};
         }
 
         [[nodiscard]] constexpr Vec4 operator-(const Vec4& other) const
         {
+#ifdef SJ_SIMD_SSE41
+            if(!std::is_constant_evaluated())
+            {
+                return FromSimd(
+                    _mm_sub_ps(math_detail::Load(m_elements), math_detail::Load(other.m_elements)));
+            }
+#endif
+
             return {m_elements[0] - other.m_elements[0],
                     m_elements[1] - other.m_elements[1],
                     m_elements[2] - other.m_elements[2],
@@ -73,6 +143,15 @@ export namespace sj
 
         constexpr Vec4& operator*=(float scalar)
         {
+#ifdef SJ_SIMD_SSE41
+            if(!std::is_constant_evaluated())
+            {
+                math_detail::Store(m_elements,
+                                   _mm_mul_ps(math_detail::Load(m_elements), _mm_set1_ps(scalar)));
+                return *this;
+            }
+#endif
+
             m_elements[0] *= scalar;
             m_elements[1] *= scalar;
             m_elements[2] *= scalar;
@@ -83,6 +162,11 @@ export namespace sj
 
         [[nodiscard]] constexpr Vec4 operator-() const
         {
+#ifdef SJ_SIMD_SSE41
+            if(!std::is_constant_evaluated())
+                return FromSimd(_mm_xor_ps(math_detail::Load(m_elements), _mm_set1_ps(-0.0f)));
+#endif
+
             return {GetX() * -1.0f, GetY() * -1.0f, GetZ() * -1.0f, GetW() * -1.0f};
         }
 
@@ -95,12 +179,38 @@ export namespace sj
 
         [[nodiscard]] constexpr float Dot(const Vec4& other) const
         {
+#ifdef SJ_SIMD_SSE41
+            if(!std::is_constant_evaluated())
+            {
+                return _mm_cvtss_f32(
+                    math_detail::Dot4(math_detail::Load(m_elements),
+                                      math_detail::Load(other.m_elements)));
+            }
+#endif
+
             return (m_elements[0] * other.m_elements[0]) + (m_elements[1] * other.m_elements[1]) +
                    (m_elements[2] * other.m_elements[2]) + (m_elements[3] * other.m_elements[3]);
         }
 
         [[nodiscard]] constexpr Vec4 Cross(const Vec4& b) const
         {
+#ifdef SJ_SIMD_SSE41
+            if(!std::is_constant_evaluated())
+            {
+                // a.yzx * b.zxy - a.zxy * b.yzx. The w lanes cancel to 0
+                const __m128 lhs = math_detail::Load(m_elements);
+                const __m128 rhs = math_detail::Load(b.m_elements);
+
+                const __m128 lhsYZX = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
+                const __m128 rhsZXY = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 1, 0, 2));
+                const __m128 lhsZXY = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 1, 0, 2));
+                const __m128 rhsYZX = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1));
+
+                return FromSimd(
+                    _mm_sub_ps(_mm_mul_ps(lhsYZX, rhsZXY), _mm_mul_ps(lhsZXY, rhsYZX)));
+            }
+#endif
+
             return {(m_elements[1] * b.m_elements[2]) - (m_elements[2] * b.m_elements[1]),
                     (m_elements[2] * b.m_elements[0]) - (m_elements[0] * b.m_elements[2]),
                     (m_elements[0] * b.m_elements[1]) - (m_elements[1] * b.m_elements[0]),
@@ -173,7 +283,12 @@ export namespace sj
 
         [[nodiscard]] auto Normalize() const -> Vec4 // Not reference!
         {
+#ifdef SJ_SIMD_SSE41
+            const __m128 v = math_detail::Load(m_elements);
+            return FromSimd(_mm_div_ps(v, _mm_sqrt_ps(math_detail::Dot4(v, v))));
+#else
             return *this / Magnitude();
+#endif
         }
 
         [[nodiscard]] auto Normalize3_W0() const -> Vec4 // Not reference!
@@ -183,6 +298,20 @@ export namespace sj
             return tmp.Normalize();
         }
 
+#ifdef SJ_SIMD_SSE41
+        [[nodiscard]] static Vec4 FromSimd(__m128 value)
+        {
+            Vec4 result;
+            math_detail::Store(result.m_elements, value);
+            return result;
+        }
+
+        [[nodiscard]] __m128 ToSimd() const
+        {
+            return math_detail::Load(m_elements);
+        }
+#endif
+
     private:
         std::array<float, 4> m_elements = {};
     };
@@ -197,6 +326,11 @@ export namespace sj
 
     [[nodiscard]] constexpr Vec4 operator*(const Vec4& v, const float s)
     {
+#ifdef SJ_SIMD_SSE41
+        if(!std::is_constant_evaluated())
+            return Vec4::FromSimd(_mm_mul_ps(v.ToSimd(), _mm_set1_ps(s)));
+#endif
+
         return {v.GetX() * s, v.GetY() * s, v.GetZ() * s, v.GetW() * s};
     }
 
@@ -207,6 +341,11 @@ export namespace sj
 
     [[nodiscard]] constexpr Vec4 operator+(const Vec4& a, const Vec4& b)
     {
+#ifdef SJ_SIMD_SSE41
+        if(!std::is_constant_evaluated())
+            return Vec4::FromSimd(_mm_add_ps(a.ToSimd(), b.ToSimd()));
+#endif
+
         return {a.GetX() + b.GetX(), a.GetY() + b.GetY(), a.GetZ() + b.GetZ(), a.GetW() + b.GetW()};
     }
 
@@ -8,4 +8,8 @@ export import :Mat44;
 export import :Tags;
 export import :VecHash;
 export import :Helpers;
-export import :Quat;
\ No newline at end of file
+export import :Quat;
+export import :AABB;
+export import :Batch;
+export import :Transform;
+export import :Frustum;
\ No newline at end of file
@@ -3,8 +3,9 @@ module;
 #include <ScrewjankStd/Assert.hpp>
 
 #include <algorithm>
-#include <utility>
 #include <cstdint>
+#include <mutex>
+#include <utility>
 
 export module sj.std.memory.resources.free_list_allocator;
 import sj.std.memory.resources.memory_resource;
@@ -95,6 +96,8 @@ export namespace sj
         void* do_allocate(const size_t size,
                           const size_t alignment = alignof(std::max_align_t)) override
         {
+            std::scoped_lock lock(m_freeListLock);
+
             SJ_ASSERT(m_freeBlocks.back().next == nullptr, "what");
 
             SJ_ASSERT(is_initialized(), "Trying to allocate with uninitialized allocator");
@@ -162,6 +165,9 @@ export namespace sj
                 AddFreeBlock(new_block);
             }
 
+#ifndef SJ_GOLD
+            notify_allocate(payload_address, size, alignment);
+#endif
 
             return payload_address;
         }
@@ -178,6 +184,12 @@ export namespace sj
             SJ_ASSERT(memory != nullptr, "Cannot free nullptr");
             SJ_ASSERT(contains_ptr(memory), "Pointer is not managed by this allocator!");
 
+#ifndef SJ_GOLD
+            notify_deallocate(memory, bytes);
+#endif
+
+            std::scoped_lock lock(m_freeListLock);
+
             AllocationHeader* block_header = GetAllocationHeader(memory);
 
             // Extract header info
@@ -194,6 +206,65 @@ export namespace sj
             SJ_ASSERT(m_freeBlocks.back().next == nullptr, "what");
         }
 
+        /**
+         * Grows an allocation into the free block directly after it, if there is one
+         */
+        [[nodiscard]] bool do_try_expand(void* memory,
+                                         [[maybe_unused]] size_t old_bytes,
+                                         size_t new_bytes) override
+        {
+            SJ_ASSERT(contains_ptr(memory), "Pointer is not managed by this allocator!");
+
+            std::scoped_lock lock(m_freeListLock);
+
+            AllocationHeader* header = GetAllocationHeader(memory);
+            if(new_bytes <= header->size)
+                return true;
+
+            // Allocations always end where the next block (free or not) begins
+            const uintptr_t block_end = uintptr_t(memory) + header->size;
+
+            // The free list is sorted by address
+            auto adjacent_it =
+                std::ranges::find_if(m_freeBlocks, [block_end](const FreeBlock& block) {
+                    return uintptr_t(&block) >= block_end;
+                });
+
+            if(adjacent_it == m_freeBlocks.end() || uintptr_t(&(*adjacent_it)) != block_end)
+                return false;
+
+            FreeBlock* adjacent = &(*adjacent_it);
+            const uintptr_t available_end = block_end + adjacent->size;
+            const uintptr_t payload_end = uintptr_t(memory) + new_bytes;
+            if(payload_end > available_end)
+                return false;
+
+            m_freeBlocks.erase(adjacent);
+
+            // Split off whatever the expansion doesn't need, as do_allocate does
+            auto new_block_adjustment =
+                GetAlignmentAdjustment(alignof(FreeBlock), reinterpret_cast<void*>(payload_end));
+
+            const uintptr_t new_block_start = payload_end + new_block_adjustment;
+            if(new_block_start < available_end && available_end - new_block_start >= kMinBlockSize)
+            {
+                header->size = new_block_start - uintptr_t(memory);
+                AddFreeBlock(new(reinterpret_cast<void*>(new_block_start))
+                                 FreeBlock(available_end - new_block_start));
+            }
+            else
+            {
+                header->size = available_end - uintptr_t(memory);
+            }
+
+#ifndef SJ_GOLD
+            notify_deallocate(memory, old_bytes);
+            notify_allocate(memory, new_bytes, alignof(std::max_align_t));
+#endif
+
+            return true;
+        }
+
         /** Linked list node structure inserted in-place into the allocator's buffer */
         struct FreeBlock
         {
@@ -350,6 +421,12 @@ export namespace sj
         /** The free list of allocation blocks */
         unmanaged_list<FreeBlock> m_freeBlocks;
 
+        /**
+         * Guards m_freeBlocks and the in-place headers. Any thread may free into this allocator,
+         * since global delete routes pointers back to whichever resource owns them
+         */
+        std::mutex m_freeListLock;
+
         /** Pointer to the start of the allocator's memory block */
         void* m_bufferStart;
 
@@ -2,8 +2,10 @@ module;
 #include <ScrewjankStd/Log.hpp>
 #include <ScrewjankStd/Assert.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <memory_resource>
 
 export module sj.std.memory.resources.linear_allocator;
 import sj.std.memory.resources.memory_resource;
@@ -13,7 +15,18 @@ export namespace sj
 {
     class linear_allocator final : public sj::memory_resource
     {
+        struct overflow_block;
+
     public:
+        /**
+         * Position in the allocator that can be rewound to, including any overflow blocks
+         */
+        struct marker
+        {
+            void* cursor = nullptr;
+            overflow_block* block = nullptr;
+        };
+
         linear_allocator() = default;
 
         explicit linear_allocator(size_t buffer_size, std::byte* memory)
@@ -30,23 +43,89 @@ export namespace sj
             m_CurrFrameStart = memory;
         }
 
-        ~linear_allocator() final = default;
+        ~linear_allocator() final
+        {
+            release_overflow_blocks(nullptr);
+        }
 
+        /**
+         * Allows the allocator to chain extra blocks from parent when the main buffer is exhausted.
+         * Blocks are returned to parent when the allocator is reset past them.
+         * @param min_block_size Smallest block requested from parent. Defaults to the buffer size
+         */
+        void set_overflow_resource(std::pmr::memory_resource* parent, size_t min_block_size = 0)
+        {
+            SJ_ASSERT(m_CurrBlock == nullptr, "Cannot change overflow resource while it is in use");
+            m_OverflowResource = parent;
+            m_MinOverflowBlockSize = min_block_size;
+        }
+
+        /**
+         * @return Offset of the cursor into the main buffer. Overflow blocks are not included
+         */
         auto get_current_offset() -> size_t
         {
+            if(m_CurrBlock != nullptr)
+                return buffer_size();
+
             return uintptr_t(m_CurrFrameStart) - uintptr_t(m_BufferStart);
         }
 
+        [[nodiscard]] marker get_marker() const
+        {
+            return {.cursor = m_CurrFrameStart, .block = m_CurrBlock};
+        }
+
         void reset()
         {
+            release_overflow_blocks(nullptr);
             m_CurrFrameStart = m_BufferStart;
         }
 
         void reset(size_t to_offset)
         {
+            release_overflow_blocks(nullptr);
             m_CurrFrameStart = reinterpret_cast<void*>(uintptr_t(m_BufferStart) + to_offset);
         }
 
+        /**
+         * Rewinds the allocator to to_marker, freeing overflow blocks allocated after it
+         */
+        void reset(marker to_marker)
+        {
+            release_overflow_blocks(to_marker.block);
+            m_CurrFrameStart = to_marker.cursor;
+        }
+
+        /**
+         * @return Bytes consumed across the main buffer and all live overflow blocks
+         */
+        [[nodiscard]] size_t bytes_in_use() const
+        {
+            if(m_CurrBlock == nullptr)
+                return uintptr_t(m_CurrFrameStart) - uintptr_t(m_BufferStart);
+
+            return m_CurrBlock->bytes_before + uintptr_t(m_CurrFrameStart) -
+                   uintptr_t(m_CurrBlock->payload());
+        }
+
+        /**
+         * @return The largest value bytes_in_use() has reached
+         */
+        [[nodiscard]] size_t get_high_water_mark() const
+        {
+            return m_HighWaterMark;
+        }
+
+        [[nodiscard]] size_t get_overflow_block_count() const
+        {
+            size_t count = 0;
+            for(overflow_block* block = m_CurrBlock; block != nullptr; block = block->prev)
+                count++;
+
+            return count;
+        }
+
         [[nodiscard]] bool is_initialized() const
         {
             return m_BufferStart != nullptr;
@@ -54,7 +133,16 @@ export namespace sj
 
         bool contains_ptr(void* memory) const override
         {
-            return IsPointerInAddressSpace(memory, m_BufferStart, m_BufferEnd);
+            if(IsPointerInAddressSpace(memory, m_BufferStart, m_BufferEnd))
+                return true;
+
+            for(overflow_block* block = m_CurrBlock; block != nullptr; block = block->prev)
+            {
+                if(IsPointerInAddressSpace(memory, block->payload(), block->end))
+                    return true;
+            }
+
+            return false;
         }
 
         void* data() 
@@ -68,32 +156,103 @@ export namespace sj
         }
 
     private:
+        /**
+         * Header placed at the start of each block chained from the overflow resource
+         */
+        struct overflow_block
+        {
+            overflow_block* prev = nullptr;
+            void* end = nullptr;
+            size_t size = 0;
+
+            /** bytes_in_use() at the moment this block was chained */
+            size_t bytes_before = 0;
+
+            void* payload()
+            {
+                return this + 1;
+            }
+        };
+
         [[nodiscard]] void* do_allocate(const size_t size,
                                         const size_t alignment = alignof(std::max_align_t)) override
         {
-            size_t free_space = uintptr_t(m_BufferEnd) - uintptr_t(m_CurrFrameStart);
-
             SJ_ASSERT(is_initialized(), "Trying to allocate with uninitialized allocator!");
 
+            void* curr_end = m_CurrBlock ? m_CurrBlock->end : m_BufferEnd;
+            size_t free_space = uintptr_t(curr_end) - uintptr_t(m_CurrFrameStart);
+
             // Ensure there is enough space to satisfy allocation
             if(free_space < size + GetAlignmentOffset(alignment, m_CurrFrameStart))
             {
-                SJ_ENGINE_LOG_FATAL(
-                    "Allocator has insufficient memory to perform requested allocation");
-                return nullptr;
+                if(m_OverflowResource == nullptr || !push_overflow_block(size, alignment))
+                {
+                    SJ_ENGINE_LOG_FATAL(
+                        "Allocator has insufficient memory to perform requested allocation");
+                    return nullptr;
+                }
+
+                curr_end = m_CurrBlock->end;
+                free_space = uintptr_t(curr_end) - uintptr_t(m_CurrFrameStart);
             }
 
             auto allocated_memory = AlignMemory(alignment, size, m_CurrFrameStart, free_space);
 
-            SJ_ASSERT(uintptr_t(allocated_memory) + size <= uintptr_t(m_BufferEnd), "Linear Allocator is out of memory!");
+            SJ_ASSERT(uintptr_t(allocated_memory) + size <= uintptr_t(curr_end),
+                      "Linear Allocator is out of memory!");
 
             // Bump allocation pointer to the first free byte after the current allocation
             m_CurrFrameStart =
                 reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(allocated_memory) + size);
 
+            m_HighWaterMark = std::max(m_HighWaterMark, bytes_in_use());
+
             return allocated_memory;
         }
 
+        /**
+         * Chains a new block from the overflow resource large enough to hold the request
+         */
+        bool push_overflow_block(size_t size, size_t alignment)
+        {
+            const size_t min_block_size =
+                m_MinOverflowBlockSize != 0 ? m_MinOverflowBlockSize : buffer_size();
+            const size_t block_size =
+                std::max(min_block_size, sizeof(overflow_block) + size + alignment);
+
+            void* memory = m_OverflowResource->allocate(block_size, alignof(overflow_block));
+            if(memory == nullptr)
+                return false;
+
+            auto* block = new(memory) overflow_block {
+                .prev = m_CurrBlock,
+                .end = reinterpret_cast<void*>(uintptr_t(memory) + block_size),
+                .size = block_size,
+                .bytes_before = bytes_in_use()};
+
+            m_CurrBlock = block;
+            m_CurrFrameStart = block->payload();
+
+            return true;
+        }
+
+        /**
+         * Returns every overflow block chained after stop_at to the overflow resource
+         */
+        void release_overflow_blocks(overflow_block* stop_at)
+        {
+            while(m_CurrBlock != stop_at)
+            {
+                SJ_ASSERT(m_CurrBlock != nullptr, "Marker does not belong to this allocator");
+
+                overflow_block* prev = m_CurrBlock->prev;
+                m_OverflowResource->deallocate(m_CurrBlock,
+                                               m_CurrBlock->size,
+                                               alignof(overflow_block));
+                m_CurrBlock = prev;
+            }
+        }
+
         /**
          * @note Linear Allocators don't support the free operation, expected to just call reset
          * eventually
@@ -113,5 +272,15 @@ export namespace sj
 
         /** Pointer to the first free byte in the linear allocator */
         void* m_CurrFrameStart = nullptr;
+
+        /** Resource extra blocks are chained from when the buffer is exhausted */
+        std::pmr::memory_resource* m_OverflowResource = nullptr;
+
+        /** Most recently chained overflow block, or nullptr while allocating from the buffer */
+        overflow_block* m_CurrBlock = nullptr;
+
+        size_t m_MinOverflowBlockSize = 0;
+
+        size_t m_HighWaterMark = 0;
     };
 } // namespace sj
@@ -33,6 +33,27 @@ export namespace sj
         { obj->deallocate(nullptr) };
     };
 
+    class memory_resource;
+
+#ifndef SJ_GOLD
+    /**
+     * Debug hook notified whenever a resource services an allocation request.
+     * Listeners must not allocate from the resource they are attached to.
+     */
+    class allocation_listener
+    {
+    public:
+        virtual ~allocation_listener() = default;
+
+        virtual void on_allocate(const memory_resource& resource,
+                                 void* ptr,
+                                 size_t bytes,
+                                 size_t alignment) = 0;
+
+        virtual void on_deallocate(const memory_resource& resource, void* ptr, size_t bytes) = 0;
+    };
+#endif
+
     class memory_resource : public std::pmr::memory_resource
     {
     public:
@@ -50,19 +71,66 @@ export namespace sj
         
         [[nodiscard]] virtual bool contains_ptr(void* ptr) const = 0;
 
+        /**
+         * Attempts to grow an allocation without moving it
+         * @param ptr Allocation previously returned by this resource
+         * @param old_bytes Size the allocation was requested with
+         * @param new_bytes Size the allocation should be grown to
+         * @return True if ptr now holds at least new_bytes. On failure the allocation is unchanged
+         */
+        [[nodiscard]] bool try_expand(void* ptr, size_t old_bytes, size_t new_bytes)
+        {
+            return do_try_expand(ptr, old_bytes, new_bytes);
+        }
+
 #ifndef SJ_GOLD
         void set_debug_name(const char* name)
         {
-            std::format_to_n(m_DebugName.data(), 256, "{}", name);
+            std::format_to_n(m_DebugName.data(), m_DebugName.size() - 1, "{}", name);
         }
+
+        [[nodiscard]] const char* get_debug_name() const
+        {
+            return m_DebugName.data();
+        }
+
+        void set_allocation_listener(allocation_listener* listener)
+        {
+            m_listener = listener;
+        }
+
     protected:
         [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
         {
             return uintptr_t(this) == uintptr_t(&other);
         }
 
+        void notify_allocate(void* ptr, size_t bytes, size_t alignment) const
+        {
+            if(m_listener)
+                m_listener->on_allocate(*this, ptr, bytes, alignment);
+        }
+
+        void notify_deallocate(void* ptr, size_t bytes) const
+        {
+            if(m_listener)
+                m_listener->on_deallocate(*this, ptr, bytes);
+        }
+
     private:
         std::array<char, 256> m_DebugName = {};
+        allocation_listener* m_listener = nullptr;
 #endif
+
+    protected:
+        /**
+         * Resources that can grow an allocation in place override this. By default nothing expands
+         */
+        [[nodiscard]] virtual bool do_try_expand([[maybe_unused]] void* ptr,
+                                                 [[maybe_unused]] size_t old_bytes,
+                                                 [[maybe_unused]] size_t new_bytes)
+        {
+            return false;
+        }
     };
 } // namespace sj
@@ -12,12 +12,13 @@ export namespace sj
     public:
         scratchpad_scope(linear_allocator& resource) : m_resource(resource)
         {
-            m_originalOffset = m_resource.get_current_offset();
+            m_originalMarker = m_resource.get_marker();
         }
 
         ~scratchpad_scope()
         {
-            m_resource.reset(m_originalOffset);
+            // Also frees any overflow blocks chained while the scope was open
+            m_resource.reset(m_originalMarker);
         }
 
         linear_allocator& get_allocator()
@@ -26,7 +27,7 @@ export namespace sj
         }
 
     private:
-        size_t m_originalOffset = 0;
+        linear_allocator::marker m_originalMarker;
         linear_allocator& m_resource;
     };
 } // namespace sj
\ No newline at end of file
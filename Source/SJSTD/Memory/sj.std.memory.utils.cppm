@@ -10,6 +10,12 @@ export module sj.std.memory.utils;
 
 export namespace sj
 {
+    /**
+     * Assumed size of a cache line. Data written by different threads should be kept at least
+     * this far apart to avoid false sharing
+     */
+    inline constexpr size_t kCacheLineSize = 64;
+
     uintptr_t GetAlignmentOffset(size_t align_of, const void* const ptr)
     {
         SJ_ASSERT(align_of != 0, "Zero is not a valid memory alignment requirement.");
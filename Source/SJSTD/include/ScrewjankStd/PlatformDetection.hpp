@@ -51,6 +51,30 @@ namespace sj {
     constexpr Compiler g_Compiler = Compiler::Unknown;
 #endif // _MSC_VER
 
+    /**
+     * Detect SIMD instruction sets enabled for this build.
+     * Selected at compile time via SJ_SIMD_ARCH, define SJ_FORCE_SCALAR_MATH to disable.
+     * MSVC has no SSE4.1 macro or /arch level, so the build defines SJ_TARGET_SSE41 for it
+     */
+    enum class SimdLevel
+    {
+        Scalar,
+        SSE41,
+        AVX2
+    };
+
+#if !defined(SJ_FORCE_SCALAR_MATH) && (defined(__SSE4_1__) || defined(SJ_TARGET_SSE41))
+    #define SJ_SIMD_SSE41
+    #if defined(__AVX2__) && (defined(__FMA__) || defined(SJ_COMPILER_MSVC))
+        #define SJ_SIMD_AVX2
+        constexpr SimdLevel g_SimdLevel = SimdLevel::AVX2;
+    #else
+        constexpr SimdLevel g_SimdLevel = SimdLevel::SSE41;
+    #endif
+#else
+    constexpr SimdLevel g_SimdLevel = SimdLevel::Scalar;
+#endif
+
     /**
      * Detect build configuration
      */
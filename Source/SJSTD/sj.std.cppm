@@ -8,8 +8,10 @@ export import sj.std.memory;
 export import sj.std.concepts;
 export import sj.std.signal;
 export import sj.std.hash;
+export import sj.std.inplace_function;
 export import sj.std.string_hash;
 export import sj.std.string_literal;
+export import sj.std.string_pool;
 export import sj.std.tuple;
 export import sj.std.type_info;
 export import sj.std.type_traits;
@@ -1,12 +1,147 @@
 module;
 
+#include <bit>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <span>
 #include <ranges>
 #include <string_view>
+#include <type_traits>
 
 export module sj.std.hash;
 
+namespace sj::hash_detail
+{
+/** wyhash default secret */
+constexpr uint64_t kWySecret[4] = {0x2d358dccaa6c78a5ull,
+                                   0x8bb84b93962eacc9ull,
+                                   0x4b33a62ed433d4a3ull,
+                                   0x4d5a2da51de1aa47ull};
+
+/** 64x64 -> 128 bit multiply. lo and hi receive the low and high halves */
+constexpr void Mum(uint64_t& lo, uint64_t& hi)
+{
+#ifdef __SIZEOF_INT128__
+    const __uint128_t product = static_cast<__uint128_t>(lo) * hi;
+    lo = static_cast<uint64_t>(product);
+    hi = static_cast<uint64_t>(product >> 64);
+#else
+    const uint64_t aHi = lo >> 32;
+    const uint64_t aLo = static_cast<uint32_t>(lo);
+    const uint64_t bHi = hi >> 32;
+    const uint64_t bLo = static_cast<uint32_t>(hi);
+
+    const uint64_t loLo = aLo * bLo;
+    const uint64_t hiLo = aHi * bLo;
+    const uint64_t loHi = aLo * bHi;
+    const uint64_t hiHi = aHi * bHi;
+
+    const uint64_t cross = (loLo >> 32) + static_cast<uint32_t>(hiLo) + loHi;
+    lo = (cross << 32) | static_cast<uint32_t>(loLo);
+    hi = hiHi + (hiLo >> 32) + (cross >> 32);
+#endif
+}
+
+constexpr uint64_t Mix(uint64_t a, uint64_t b)
+{
+    Mum(a, b);
+    return a ^ b;
+}
+
+/** Little endian load of N bytes. A single unaligned load at runtime */
+template <size_t N, class Byte>
+constexpr uint64_t Read(const Byte* p)
+{
+    if(!std::is_constant_evaluated())
+    {
+        std::conditional_t<N == 8, uint64_t, uint32_t> value;
+        std::memcpy(&value, p, N);
+
+        if constexpr(std::endian::native == std::endian::big)
+            value = std::byteswap(value);
+
+        return value;
+    }
+
+    uint64_t value = 0;
+    for(size_t i = 0; i < N; i++)
+        value |= uint64_t(static_cast<uint8_t>(p[i])) << (8 * i);
+
+    return value;
+}
+
+/** Inputs of 1 to 3 bytes */
+template <class Byte>
+constexpr uint64_t Read3(const Byte* p, size_t len)
+{
+    return (uint64_t(static_cast<uint8_t>(p[0])) << 16) |
+           (uint64_t(static_cast<uint8_t>(p[len >> 1])) << 8) |
+           uint64_t(static_cast<uint8_t>(p[len - 1]));
+}
+
+/** wyhash final version 4.2 */
+template <class Byte>
+constexpr uint64_t WyHash(const Byte* p, size_t len, uint64_t seed)
+{
+    const uint64_t* secret = kWySecret;
+    seed ^= Mix(seed ^ secret[0], secret[1]);
+
+    uint64_t a = 0;
+    uint64_t b = 0;
+
+    if(len <= 16)
+    {
+        if(len >= 4)
+        {
+            const size_t mid = (len >> 3) << 2;
+            a = (Read<4>(p) << 32) | Read<4>(p + mid);
+            b = (Read<4>(p + len - 4) << 32) | Read<4>(p + len - 4 - mid);
+        }
+        else if(len > 0)
+        {
+            a = Read3(p, len);
+        }
+    }
+    else
+    {
+        size_t remaining = len;
+        if(remaining >= 48)
+        {
+            // Three independent lanes keep the multipliers busy
+            uint64_t see1 = seed;
+            uint64_t see2 = seed;
+            do
+            {
+                seed = Mix(Read<8>(p) ^ secret[1], Read<8>(p + 8) ^ seed);
+                see1 = Mix(Read<8>(p + 16) ^ secret[2], Read<8>(p + 24) ^ see1);
+                see2 = Mix(Read<8>(p + 32) ^ secret[3], Read<8>(p + 40) ^ see2);
+                p += 48;
+                remaining -= 48;
+            } while(remaining >= 48);
+
+            seed ^= see1 ^ see2;
+        }
+
+        while(remaining > 16)
+        {
+            seed = Mix(Read<8>(p) ^ secret[1], Read<8>(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+
+        a = Read<8>(p + remaining - 16);
+        b = Read<8>(p + remaining - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    Mum(a, b);
+
+    return Mix(a ^ secret[0] ^ len, b ^ secret[1]);
+}
+} // namespace sj::hash_detail
+
 export namespace sj
 {
 inline constexpr uint32_t fnv_offset_basis_32 = 0x811c9dc5;
@@ -77,4 +212,19 @@ constexpr uint64_t FNV1a_64(std::ranges::range auto elems, uint64_t hash = fnv_o
     }
     return hash;
 }
-} // namespace sj
\ No newline at end of file
+
+/**
+ * 64 bit wyhash (final version 4.2). Consumes 8 to 48 bytes per step instead of FNV's one and is
+ * far less collision prone than FNV1a_32. Usable in constant expressions, with identical results
+ * at compile time, at runtime and across platforms
+ */
+constexpr uint64_t WyHash64(std::span<const std::byte> bytes, uint64_t seed = 0)
+{
+    return hash_detail::WyHash(bytes.data(), bytes.size(), seed);
+}
+
+constexpr uint64_t WyHash64(std::string_view str, uint64_t seed = 0)
+{
+    return hash_detail::WyHash(str.data(), str.size(), seed);
+}
+} // namespace sj
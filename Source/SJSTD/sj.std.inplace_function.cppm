@@ -0,0 +1,169 @@
+module;
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <ScrewjankStd/Assert.hpp>
+
+export module sj.std.inplace_function;
+
+export namespace sj
+{
+
+template <class Sig, size_t tCapacity = 32>
+class inplace_function;
+
+/**
+ * std::function replacement that stores its target in tCapacity bytes inside the object and never
+ * allocates. Targets that don't fit are rejected at compile time
+ */
+template <class R, class... Args, size_t tCapacity>
+class inplace_function<R(Args...), tCapacity>
+{
+    struct vtable
+    {
+        R (*invoke)(void* storage, Args&&... args);
+        void (*copy)(void* dst, const void* src);
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void* storage);
+    };
+
+    template <class Fn>
+    static constexpr vtable kVTable = {
+        .invoke = [](void* storage, Args&&... args) -> R {
+            return std::invoke(*static_cast<Fn*>(storage), std::forward<Args>(args)...);
+        },
+        .copy = [](void* dst, const void* src) {
+            ::new(dst) Fn(*static_cast<const Fn*>(src));
+        },
+        .move = [](void* dst, void* src) {
+            ::new(dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        },
+        .destroy = [](void* storage) { static_cast<Fn*>(storage)->~Fn(); },
+    };
+
+public:
+    using result_type = R;
+
+    static constexpr size_t kCapacity = tCapacity;
+
+    inplace_function() noexcept = default;
+
+    inplace_function(std::nullptr_t) noexcept
+    {
+    }
+
+    template <class Fn>
+        requires(!std::is_same_v<std::remove_cvref_t<Fn>, inplace_function> &&
+                 std::is_invocable_r_v<R, std::decay_t<Fn>&, Args...>)
+    inplace_function(Fn&& fn)
+    {
+        using Target = std::decay_t<Fn>;
+
+        static_assert(sizeof(Target) <= tCapacity,
+                      "Callable is too large for this inplace_function. Increase its capacity");
+        static_assert(alignof(Target) <= alignof(std::max_align_t),
+                      "Callable is over-aligned for inplace_function storage");
+        static_assert(std::is_copy_constructible_v<Target>,
+                      "inplace_function targets must be copy constructible");
+
+        ::new(m_storage) Target(std::forward<Fn>(fn));
+        m_vtable = &kVTable<Target>;
+    }
+
+    inplace_function(const inplace_function& other) : m_vtable(other.m_vtable)
+    {
+        if(m_vtable)
+            m_vtable->copy(m_storage, other.m_storage);
+    }
+
+    inplace_function(inplace_function&& other) noexcept : m_vtable(other.m_vtable)
+    {
+        if(m_vtable)
+        {
+            m_vtable->move(m_storage, other.m_storage);
+            other.m_vtable = nullptr;
+        }
+    }
+
+    ~inplace_function()
+    {
+        reset();
+    }
+
+    inplace_function& operator=(const inplace_function& other)
+    {
+        if(this != &other)
+        {
+            reset();
+            m_vtable = other.m_vtable;
+            if(m_vtable)
+                m_vtable->copy(m_storage, other.m_storage);
+        }
+
+        return *this;
+    }
+
+    inplace_function& operator=(inplace_function&& other) noexcept
+    {
+        if(this != &other)
+        {
+            reset();
+            m_vtable = std::exchange(other.m_vtable, nullptr);
+            if(m_vtable)
+                m_vtable->move(m_storage, other.m_storage);
+        }
+
+        return *this;
+    }
+
+    inplace_function& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    template <class Fn>
+        requires(!std::is_same_v<std::remove_cvref_t<Fn>, inplace_function> &&
+                 std::is_invocable_r_v<R, std::decay_t<Fn>&, Args...>)
+    inplace_function& operator=(Fn&& fn)
+    {
+        return *this = inplace_function(std::forward<Fn>(fn));
+    }
+
+    R operator()(Args... args) const
+    {
+        SJ_ASSERT(m_vtable != nullptr, "Calling empty inplace_function");
+        return m_vtable->invoke(const_cast<std::byte*>(m_storage), std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return m_vtable != nullptr;
+    }
+
+    void reset() noexcept
+    {
+        if(m_vtable)
+        {
+            m_vtable->destroy(m_storage);
+            m_vtable = nullptr;
+        }
+    }
+
+    friend bool operator==(const inplace_function& fn, std::nullptr_t) noexcept
+    {
+        return !fn;
+    }
+
+private:
+    const vtable* m_vtable = nullptr;
+    alignas(std::max_align_t) std::byte m_storage[tCapacity];
+};
+
+} // namespace sj
@@ -1,51 +1,191 @@
 module;
 
 #include <cstddef>
-#include <functional>
-#include <memory>
+#include <cstdint>
+#include <memory_resource>
+#include <utility>
+
+#include <ScrewjankStd/Assert.hpp>
 
 export module sj.std.signal;
-import sj.std.containers.map;
-import sj.std.type_info;
+import sj.std.containers.vector;
+import sj.std.inplace_function;
 
 export namespace sj
 {
 
-using signal_handle = size_t;
+/**
+ * Identifies one connection to a signal. Handles to disconnected slots are detected through the
+ * generation, even after their index has been reused
+ */
+struct signal_handle
+{
+    static constexpr uint32_t kInvalidIndex = ~uint32_t(0);
+
+    uint32_t index = kInvalidIndex;
+    uint32_t generation = 0;
+
+    [[nodiscard]] bool is_valid() const
+    {
+        return index != kInvalidIndex;
+    }
+
+    bool operator==(const signal_handle& other) const = default;
+};
 
-template <typename T>
+template <typename T, size_t tSlotCapacity = 32>
 class signal;
 
-template <class R, class ... Args>
-class signal<R(Args...)>
+/**
+ * Calls every connected slot, in connection order, on emit.
+ * Slots are inplace_functions packed in one contiguous array so connecting never allocates per
+ * slot and emitting is a linear walk. Handles go through a generation-checked indirection table,
+ * which lets slots stay packed when one is disconnected.
+ * Slots may disconnect themselves or others during emit. Connecting during emit is not supported
+ */
+template <class R, class... Args, size_t tSlotCapacity>
+class signal<R(Args...), tSlotCapacity>
 {
 public:
-    using slot_type = std::function<R(Args...)>;
+    using slot_type = inplace_function<R(Args...), tSlotCapacity>;
 
     signal() = default;
 
+    explicit signal(std::pmr::memory_resource* resource)
+        : mSlots(resource), mSlotOwners(resource), mHandles(resource)
+    {
+    }
+
     template <class Fn>
     signal_handle connect(Fn&& receiver)
     {
-        signal_handle id = mHandleCounter++;
-        mSlots[id] = std::forward<Fn>(receiver);
-        return id;
+        SJ_ASSERT(mEmitDepth == 0, "Cannot connect to a signal while it is emitting");
+
+        uint32_t index = mFreeHandleHead;
+        if(index != signal_handle::kInvalidIndex)
+        {
+            mFreeHandleHead = mHandles[index].slot;
+        }
+        else
+        {
+            index = static_cast<uint32_t>(mHandles.size());
+            mHandles.emplace_back();
+        }
+
+        HandleEntry& entry = mHandles[index];
+        entry.slot = static_cast<uint32_t>(mSlots.size());
+
+        mSlots.emplace_back(std::forward<Fn>(receiver));
+        mSlotOwners.emplace_back(index);
+
+        return {.index = index, .generation = entry.generation};
+    }
+
+    /**
+     * Removes the slot behind handle. Stale and invalid handles are ignored
+     */
+    void disconnect(signal_handle handle)
+    {
+        if(!is_connected(handle))
+            return;
+
+        HandleEntry& entry = mHandles[handle.index];
+        const uint32_t slot = entry.slot;
+
+        entry.generation++;
+        entry.slot = mFreeHandleHead;
+        mFreeHandleHead = handle.index;
+
+        if(mEmitDepth > 0)
+        {
+            // The array is being walked and the slot may be the one running.
+            // Orphan it now and destroy it when emit finishes
+            mSlotOwners[slot] = signal_handle::kInvalidIndex;
+            mNeedsCompaction = true;
+            return;
+        }
+
+        mSlots.erase(mSlots.begin() + slot);
+        mSlotOwners.erase(mSlotOwners.begin() + slot);
+        ReindexFrom(slot);
+    }
+
+    [[nodiscard]] bool is_connected(signal_handle handle) const
+    {
+        return handle.index < mHandles.size() &&
+               mHandles[handle.index].generation == handle.generation;
     }
 
-    void disconnect(signal_handle id)
+    /** Number of connected slots */
+    [[nodiscard]] size_t size() const
     {
-        mSlots.erase(id);
+        return mSlots.size();
     }
 
-    void emit(const Args&& ... args)
+    void emit(Args... args)
     {
-        for(auto& slot : mSlots.values())
-            slot(args ... );
+        mEmitDepth++;
+
+        // Slots disconnected during emit stay in place, orphaned, until compaction
+        const size_t count = mSlots.size();
+        for(size_t i = 0; i < count; i++)
+        {
+            if(mSlotOwners[i] != signal_handle::kInvalidIndex)
+                mSlots[i](args...);
+        }
+
+        mEmitDepth--;
+
+        if(mEmitDepth == 0 && mNeedsCompaction)
+            Compact();
     }
 
 private:
-    size_t mHandleCounter = 0;
-    dynamic_flat_map<size_t, slot_type> mSlots;
+    struct HandleEntry
+    {
+        /** Index into mSlots while connected, next free handle while free */
+        uint32_t slot = signal_handle::kInvalidIndex;
+        uint32_t generation = 0;
+    };
+
+    /** Points handles at their slot's new position after slots at or past first have shifted */
+    void ReindexFrom(size_t first)
+    {
+        for(size_t i = first; i < mSlotOwners.size(); i++)
+            mHandles[mSlotOwners[i]].slot = static_cast<uint32_t>(i);
+    }
+
+    /** Drops slots orphaned during emit while keeping the remaining ones in order */
+    void Compact()
+    {
+        size_t write = 0;
+        for(size_t read = 0; read < mSlots.size(); read++)
+        {
+            if(mSlotOwners[read] == signal_handle::kInvalidIndex)
+                continue;
+
+            if(write != read)
+            {
+                mSlots[write] = std::move(mSlots[read]);
+                mSlotOwners[write] = mSlotOwners[read];
+            }
+
+            write++;
+        }
+
+        mSlots.resize(write);
+        mSlotOwners.resize(write);
+        ReindexFrom(0);
+
+        mNeedsCompaction = false;
+    }
+
+    dynamic_vector<slot_type> mSlots;
+    dynamic_vector<uint32_t> mSlotOwners;
+    dynamic_vector<HandleEntry> mHandles;
+    uint32_t mFreeHandleHead = signal_handle::kInvalidIndex;
+    uint32_t mEmitDepth = 0;
+    bool mNeedsCompaction = false;
 };
 
-} // namespace sj
\ No newline at end of file
+} // namespace sj
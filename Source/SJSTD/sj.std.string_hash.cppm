@@ -53,6 +53,43 @@ inline constexpr sj::string_hash operator""_strhash(const char* str, std::size_t
     return sj::string_hash(str);
 }
 
+/**
+ * 64 bit counterpart of string_hash for large name spaces such as asset paths,
+ * where 32 bit hashes start to collide
+ */
+class string_hash64
+{
+public:
+    constexpr string_hash64() = default;
+
+    explicit constexpr string_hash64(uint64_t intVal) : m_hash(intVal)
+    {
+    }
+
+    constexpr string_hash64(const char* str) : m_hash(WyHash64(str))
+    {
+    }
+
+    constexpr string_hash64(std::string_view str) : m_hash(WyHash64(str))
+    {
+    }
+
+    constexpr std::strong_ordering operator<=>(const string_hash64& other) const = default;
+
+    constexpr uint64_t AsInt() const
+    {
+        return m_hash;
+    }
+
+private:
+    uint64_t m_hash = 0;
+};
+
+inline constexpr sj::string_hash64 operator""_strhash64(const char* str, std::size_t len)
+{
+    return sj::string_hash64(std::string_view(str, len));
+}
+
 template <class tStrContainer>
 class hashed_string
 {
@@ -66,6 +103,11 @@ public:
     explicit hashed_string(string_hash hash) : mHash(hash), mString("")
     {
     }
+
+    /** For callers that already know str's hash */
+    hashed_string(string_hash hash, const tStrContainer& str) : mHash(hash), mString(str)
+    {
+    }
     
     constexpr std::strong_ordering operator<=>(const hashed_string& other) const
     {
@@ -107,6 +149,15 @@ struct hash<sj::string_hash>
     }
 };
 
+template <>
+struct hash<sj::string_hash64>
+{
+    std::size_t operator()(const sj::string_hash64& strHash) const
+    {
+        return static_cast<std::size_t>(strHash.AsInt());
+    }
+};
+
 template <class tStrContainer>
 struct hash<sj::hashed_string<tStrContainer>>
 {
@@ -0,0 +1,140 @@
+module;
+
+// STD Headers
+#include <cstddef>
+#include <cstring>
+#include <memory_resource>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+
+// Screwjank Headers
+#include <ScrewjankStd/Assert.hpp>
+
+export module sj.std.string_pool;
+import sj.std.containers.hash_map;
+import sj.std.memory.resources.system_allocator;
+import sj.std.string_hash;
+
+export namespace sj
+{
+
+/**
+ * Append-only intern table. Each distinct string is copied into an arena once, and every
+ * hashed_string_sv handed out views that copy, so it stays valid for the life of the pool no matter
+ * what buffer the original was parsed from. Also maps a string_hash back to its text for debugging.
+ * Non-gold builds assert if two different strings produce the same hash.
+ * Thread safe. Lookups of already interned strings only take a shared lock
+ */
+class string_pool
+{
+public:
+    /**
+     * @param resource Upstream resource the arena takes blocks from
+     * @param initial_arena_size Size of the first arena block. Later blocks grow geometrically
+     */
+    explicit string_pool(std::pmr::memory_resource* resource = std::pmr::get_default_resource(),
+                         size_t initial_arena_size = 4096)
+        : m_arena(initial_arena_size, resource), m_strings(resource)
+    {
+    }
+
+    string_pool(const string_pool& other) = delete;
+    string_pool(string_pool&& other) = delete;
+    string_pool& operator=(const string_pool& other) = delete;
+    string_pool& operator=(string_pool&& other) = delete;
+
+    /**
+     * Pool for names that need to outlive whatever loaded them. Never cleared.
+     * Allocates straight from malloc so its memory isn't reported as leaked at shutdown
+     */
+    static string_pool& global()
+    {
+        // Declared first so it outlives the pool
+        static system_allocator s_resource;
+        static string_pool s_pool(&s_resource);
+        return s_pool;
+    }
+
+    /**
+     * @return str's hash paired with a view of the pool's null terminated copy of it
+     */
+    hashed_string_sv intern(std::string_view str)
+    {
+        const string_hash hash(str);
+
+        {
+            std::shared_lock lock(m_lock);
+            if(auto it = m_strings.find(hash); it != m_strings.end())
+                return hashed_string_sv(hash, validate(it->second, str));
+        }
+
+        std::unique_lock lock(m_lock);
+
+        // Another thread may have interned it between the locks
+        if(auto it = m_strings.find(hash); it != m_strings.end())
+            return hashed_string_sv(hash, validate(it->second, str));
+
+        auto* copy = static_cast<char*>(m_arena.allocate(str.size() + 1, alignof(char)));
+        std::memcpy(copy, str.data(), str.size());
+        copy[str.size()] = '\0';
+
+        const std::string_view interned(copy, str.size());
+        m_strings.try_emplace(hash, interned);
+        m_bytesInterned += str.size() + 1;
+
+        return hashed_string_sv(hash, interned);
+    }
+
+    /**
+     * @return Text that produced hash, or an empty view if it was never interned
+     */
+    [[nodiscard]] std::string_view find(string_hash hash) const
+    {
+        std::shared_lock lock(m_lock);
+
+        auto it = m_strings.find(hash);
+        return it != m_strings.end() ? it->second : std::string_view();
+    }
+
+    [[nodiscard]] bool contains(string_hash hash) const
+    {
+        std::shared_lock lock(m_lock);
+        return m_strings.contains(hash);
+    }
+
+    /** Number of distinct strings interned */
+    [[nodiscard]] size_t size() const
+    {
+        std::shared_lock lock(m_lock);
+        return m_strings.size();
+    }
+
+    /** Bytes of string data copied into the arena, including terminators */
+    [[nodiscard]] size_t bytes_interned() const
+    {
+        std::shared_lock lock(m_lock);
+        return m_bytesInterned;
+    }
+
+private:
+    static std::string_view validate([[maybe_unused]] std::string_view interned,
+                                     [[maybe_unused]] std::string_view requested)
+    {
+#ifndef SJ_GOLD
+        SJ_ASSERT(interned == requested,
+                  "string_hash collision: \"{}\" and \"{}\" hash to the same value",
+                  interned,
+                  requested);
+#endif
+
+        return interned;
+    }
+
+    mutable std::shared_mutex m_lock;
+    std::pmr::monotonic_buffer_resource m_arena;
+    dynamic_hash_map<string_hash, std::string_view> m_strings;
+    size_t m_bytesInterned = 0;
+};
+
+} // namespace sj
@@ -10,4 +10,17 @@ inline constexpr bool is_instantiation_of_v = std::false_type{};
 
 template <template <auto...> class U, auto... Vs>
 inline constexpr bool is_instantiation_of_v<U<Vs...>, U> = std::true_type{};
+
+/**
+ * True if moving a T to a new address and ending the original's lifetime is equivalent to copying
+ * its bytes. Trivially copyable types qualify automatically; other types may opt in by
+ * specializing this trait
+ */
+template <class T>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{
+};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
 } // namespace sj
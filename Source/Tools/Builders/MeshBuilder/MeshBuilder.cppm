@@ -8,8 +8,11 @@ module;
 #include <tiny_obj_loader.h>
 
 // STD Includes
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <unordered_map>
+#include <vector>
 #include <limits>
 #include <fstream>
 #include <span>
@@ -18,6 +21,7 @@ module;
 export module sj.MeshBuilder;
 import sj.build.IGlobBuilder;
 import sj.datadefs.assets;
+import sj.std.math;
 
 namespace sj::build
 {
@@ -26,6 +30,16 @@ using IndexType = decltype(tinyobj::index_t::vertex_index);
 void ExtractBuffers(const char* inputFilePath,
                     std::vector<MeshVertex>& out_verts,
                     std::vector<IndexType>& out_indices);
+
+/**
+ * Writes a low poly occlusion proxy of the mesh to output_path.
+ * The proxy keeps the mesh's largest triangles unchanged and drops the small detail ones, so it is
+ * always a subset of the original surface: it can let hidden objects through but never hides a
+ * visible one. It suits meshes dominated by large faces like walls and floors
+ */
+bool BuildOccluderProxy(std::span<const MeshVertex> verts,
+                        std::span<const IndexType> indices,
+                        const std::filesystem::path& output_path);
 } // namespace sj::build
 
 export namespace sj::build
@@ -71,6 +85,13 @@ public:
                   "Too many vertices to fit in Mesh::NumVerts");
         mesh.numIndices = static_cast<decltype(MeshHeader::numIndices)>(indices.size());
 
+        if(!verts.empty())
+        {
+            mesh.bounds = {.min = verts[0].pos, .max = verts[0].pos};
+            for(const MeshVertex& vertex : verts)
+                mesh.bounds = AABB::Merge(mesh.bounds, {.min = vertex.pos, .max = vertex.pos});
+        }
+
         std::ofstream outputFile;
         outputFile.open(output_path, std::ios::out | std::ios::binary);
         SJ_ASSERT(outputFile.is_open(), "Failed to open output file {}", output_path.c_str());
@@ -88,7 +109,9 @@ public:
 
         outputFile.close();
 
-        return true;
+        std::filesystem::path occluderPath = output_path;
+        occluderPath.replace_extension(".sj_occluder");
+        return BuildOccluderProxy(verts, indices, occluderPath);
     }
 };
 } // namespace sj::build
@@ -146,4 +169,92 @@ void ExtractBuffers(const char* inputFilePath,
     SJ_ASSERT(out_indices.size() < std::numeric_limits<uint16_t>::max(),
               "Index count out of range of uint16 for index buffers")
 }
+
+bool BuildOccluderProxy(std::span<const MeshVertex> verts,
+                        std::span<const IndexType> indices,
+                        const std::filesystem::path& output_path)
+{
+    // 512 triangles reference at most 1536 vertices, which always fits uint16 indices
+    constexpr size_t kMaxProxyTriangles = 512;
+
+    // Triangles smaller than this fraction of the total surface area are never worth rasterizing
+    constexpr float kMinAreaFraction = 0.001f;
+
+    struct SourceTriangle
+    {
+        size_t firstIndex;
+        float area;
+    };
+
+    std::vector<SourceTriangle> triangles;
+    triangles.reserve(indices.size() / 3);
+    float totalArea = 0.0f;
+
+    for(size_t i = 0; i + 2 < indices.size(); i += 3)
+    {
+        const Vec3& a = verts[indices[i]].pos;
+        const Vec3& b = verts[indices[i + 1]].pos;
+        const Vec3& c = verts[indices[i + 2]].pos;
+
+        const Vec3 ab = {.x = b.x - a.x, .y = b.y - a.y, .z = b.z - a.z};
+        const Vec3 ac = {.x = c.x - a.x, .y = c.y - a.y, .z = c.z - a.z};
+        const Vec3 cross = {.x = ab.y * ac.z - ab.z * ac.y,
+                            .y = ab.z * ac.x - ab.x * ac.z,
+                            .z = ab.x * ac.y - ab.y * ac.x};
+
+        const float area =
+            0.5f * std::sqrt(cross.x * cross.x + cross.y * cross.y + cross.z * cross.z);
+
+        totalArea += area;
+        triangles.push_back({.firstIndex = i, .area = area});
+    }
+
+    std::sort(triangles.begin(),
+              triangles.end(),
+              [](const SourceTriangle& lhs, const SourceTriangle& rhs) {
+                  return lhs.area > rhs.area;
+              });
+
+    // Source triangles are copied as-is. Any simplification that moves vertices can close
+    // openings or push the surface outwards, and then the proxy hides objects the mesh doesn't
+    const float minArea = totalArea * kMinAreaFraction;
+    const size_t proxyTriangleCount = std::min(triangles.size(), kMaxProxyTriangles);
+
+    std::unordered_map<IndexType, uint16_t> sourceToProxyVertex;
+    std::vector<Vec3> positions;
+    std::vector<uint16_t> proxyIndices;
+
+    for(size_t i = 0; i < proxyTriangleCount && triangles[i].area > minArea; i++)
+    {
+        for(size_t corner = 0; corner < 3; corner++)
+        {
+            const IndexType sourceIndex = indices[triangles[i].firstIndex + corner];
+
+            auto [it, inserted] = sourceToProxyVertex.try_emplace(
+                sourceIndex, static_cast<uint16_t>(positions.size()));
+            if(inserted)
+                positions.push_back(verts[sourceIndex].pos);
+
+            proxyIndices.push_back(it->second);
+        }
+    }
+
+    OccluderHeader occluder {};
+    occluder.numVerts = static_cast<uint32_t>(positions.size());
+    occluder.numIndices = static_cast<uint32_t>(proxyIndices.size());
+
+    std::ofstream outputFile;
+    outputFile.open(output_path, std::ios::out | std::ios::binary);
+    SJ_ASSERT(outputFile.is_open(), "Failed to open output file {}", output_path.c_str());
+    if(!outputFile.is_open())
+        return false;
+
+    outputFile.write(reinterpret_cast<char*>(&occluder), sizeof(occluder));
+    outputFile.write(reinterpret_cast<char*>(positions.data()),
+                     static_cast<std::streamsize>(sizeof(Vec3) * positions.size()));
+    outputFile.write(reinterpret_cast<char*>(proxyIndices.data()),
+                     static_cast<std::streamsize>(sizeof(uint16_t) * proxyIndices.size()));
+
+    return true;
+}
 } // namespace sj::build
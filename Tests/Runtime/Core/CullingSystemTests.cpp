@@ -0,0 +1,112 @@
+// Library Headers
+#include <gtest/gtest.h>
+
+// STD Headers
+#include <algorithm>
+#include <span>
+
+import sj.engine.core.BoundsComponent;
+import sj.engine.core.CullingSystem;
+import sj.engine.core.TransformComponent;
+import sj.engine.ecs;
+import sj.std.math;
+
+using namespace sj;
+
+namespace core_tests
+{
+
+bool Contains(std::span<const GameObjectId> ids, GameObjectId id)
+{
+    return std::ranges::any_of(ids, [id](const GameObjectId& other) {
+        return other.sparseIndex == id.sparseIndex && other.generation == id.generation;
+    });
+}
+
+class CullingSystemTests : public ::testing::Test
+{
+protected:
+    GameObjectId CreateObject(const Vec3& position)
+    {
+        GameObjectId goId = mRegistry.CreateGameObject();
+        mRegistry.CreateComponent<TransformComponent>(
+            goId,
+            nullptr,
+            Transform {.translation = position});
+        mRegistry.CreateComponent<BoundsComponent>(
+            goId,
+            AABB {.min = {-1.0f, -1.0f, -1.0f}, .max = {1.0f, 1.0f, 1.0f}});
+        return goId;
+    }
+
+    // Camera at the origin looking down -z, 90 degree FOV, square aspect. Reversed Z
+    static Mat44 ViewProjection()
+    {
+        constexpr float near = 1000.0f;
+        constexpr float far = 0.1f;
+
+        Mat44 res;
+        res.Set<0, 0>(1.0f);
+        res.Set<1, 1>(1.0f);
+        res.Set<2, 2>(far / (near - far));
+        res.Set<2, 3>(-1.0f);
+        res.Set<3, 2>((near * far) / (near - far));
+        return res;
+    }
+
+    ECSRegistry mRegistry {ComponentManifest<TransformComponent, BoundsComponent> {}};
+    CullingSystem mCulling;
+};
+
+TEST_F(CullingSystemTests, OnlyObjectsInFrontOfTheCameraAreVisible)
+{
+    const GameObjectId inFront = CreateObject({0.0f, 0.0f, -10.0f});
+    const GameObjectId behind = CreateObject({0.0f, 0.0f, 10.0f});
+    const GameObjectId toTheSide = CreateObject({50.0f, 0.0f, -10.0f});
+    const GameObjectId pastFarPlane = CreateObject({0.0f, 0.0f, -5000.0f});
+
+    mCulling.Process(mRegistry, ViewProjection());
+
+    std::span<const GameObjectId> visible = mCulling.GetVisibleGameObjects();
+    ASSERT_EQ(1, visible.size());
+    ASSERT_TRUE(Contains(visible, inFront));
+    ASSERT_FALSE(Contains(visible, behind));
+    ASSERT_FALSE(Contains(visible, toTheSide));
+    ASSERT_FALSE(Contains(visible, pastFarPlane));
+}
+
+TEST_F(CullingSystemTests, BoundsFollowTheTransform)
+{
+    // Centered behind the camera, but scaled up enough to reach in front of it
+    GameObjectId goId = mRegistry.CreateGameObject();
+    mRegistry.CreateComponent<TransformComponent>(
+        goId,
+        nullptr,
+        Transform {.translation = {0.0f, 0.0f, 5.0f}, .scale = {10.0f, 10.0f, 10.0f}});
+    mRegistry.CreateComponent<BoundsComponent>(
+        goId,
+        AABB {.min = {-1.0f, -1.0f, -1.0f}, .max = {1.0f, 1.0f, 1.0f}});
+
+    mCulling.Process(mRegistry, ViewProjection());
+    ASSERT_TRUE(Contains(mCulling.GetVisibleGameObjects(), goId));
+
+    mRegistry.GetComponent<TransformComponent>(goId)->localToParentTransform.scale = {1, 1, 1};
+
+    mCulling.Process(mRegistry, ViewProjection());
+    ASSERT_TRUE(mCulling.GetVisibleGameObjects().empty());
+}
+
+TEST_F(CullingSystemTests, ManyObjectsUseTheBatchedPath)
+{
+    // 20 visible objects in a row, interleaved with 20 behind the camera
+    for(int i = 0; i < 20; i++)
+    {
+        CreateObject({0.0f, 0.0f, -10.0f - static_cast<float>(i) * 5.0f});
+        CreateObject({0.0f, 0.0f, 10.0f + static_cast<float>(i) * 5.0f});
+    }
+
+    mCulling.Process(mRegistry, ViewProjection());
+    ASSERT_EQ(20, mCulling.GetVisibleGameObjects().size());
+}
+
+} // namespace core_tests
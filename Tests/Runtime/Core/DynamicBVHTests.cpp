@@ -0,0 +1,227 @@
+// Library Headers
+#include <gtest/gtest.h>
+
+// STD Headers
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <set>
+#include <vector>
+
+import sj.engine.core.BoundsComponent;
+import sj.engine.core.DynamicBVH;
+import sj.engine.core.SpatialSystem;
+import sj.engine.core.TransformComponent;
+import sj.engine.ecs;
+import sj.std.math;
+
+using namespace sj;
+
+namespace core_tests
+{
+
+constexpr uint32_t kNumObjects = 500;
+
+AABB Box(const Vec3& center, float extent)
+{
+    return {.min = {center.x - extent, center.y - extent, center.z - extent},
+            .max = {center.x + extent, center.y + extent, center.z + extent}};
+}
+
+class DynamicBVHTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> extent(0.1f, 3.0f);
+
+        for(uint32_t i = 0; i < kNumObjects; i++)
+        {
+            mBoxes.push_back(Box({position(rng), position(rng), position(rng)}, extent(rng)));
+            mBVH.Insert(GameObjectId {i, 0}, mBoxes.back());
+        }
+    }
+
+    std::set<uint32_t> BruteForceOverlaps(const AABB& bounds) const
+    {
+        std::set<uint32_t> result;
+        for(uint32_t i = 0; i < kNumObjects; i++)
+        {
+            if(mBVH.Contains(GameObjectId {i, 0}) && mBoxes[i].Overlaps(bounds))
+                result.insert(i);
+        }
+        return result;
+    }
+
+    std::set<uint32_t> QueryOverlaps(const AABB& bounds) const
+    {
+        std::vector<GameObjectId> out(kNumObjects);
+        const size_t count = mBVH.QueryOverlaps(bounds, out);
+
+        std::set<uint32_t> result;
+        for(size_t i = 0; i < count; i++)
+            result.insert(out[i].sparseIndex);
+        return result;
+    }
+
+    DynamicBVH mBVH;
+    std::vector<AABB> mBoxes;
+};
+
+TEST_F(DynamicBVHTests, StaysBalanced)
+{
+    ASSERT_EQ(kNumObjects, mBVH.GetSize());
+
+    // AVL bound is 1.44 * log2(n)
+    const float maxHeight = 1.45f * std::log2(static_cast<float>(kNumObjects)) + 1.0f;
+    ASSERT_LE(mBVH.GetHeight(), static_cast<int32_t>(maxHeight));
+}
+
+TEST_F(DynamicBVHTests, OverlapsMatchBruteForce)
+{
+    for(float extent : {0.5f, 10.0f, 50.0f})
+    {
+        const AABB query = Box({10.0f, -20.0f, 5.0f}, extent);
+        ASSERT_EQ(BruteForceOverlaps(query), QueryOverlaps(query));
+    }
+}
+
+TEST_F(DynamicBVHTests, QueriesReportTotalWhenBufferIsTooSmall)
+{
+    const AABB everything = Box({0.0f, 0.0f, 0.0f}, 1000.0f);
+
+    std::vector<GameObjectId> out(4);
+    ASSERT_EQ(kNumObjects, mBVH.QueryOverlaps(everything, out));
+}
+
+TEST_F(DynamicBVHTests, UpdateAndRemove)
+{
+    // Move every object far away, then remove every other one
+    for(uint32_t i = 0; i < kNumObjects; i++)
+    {
+        Vec3 center = mBoxes[i].GetCenter();
+        center += Vec3 {500.0f, 0.0f, 0.0f};
+
+        mBoxes[i] = Box(center, 1.0f);
+        ASSERT_TRUE(mBVH.Update(GameObjectId {i, 0}, mBoxes[i]));
+    }
+
+    for(uint32_t i = 0; i < kNumObjects; i += 2)
+        mBVH.Remove(GameObjectId {i, 0});
+
+    ASSERT_EQ(kNumObjects / 2, mBVH.GetSize());
+    ASSERT_TRUE(QueryOverlaps(Box({0.0f, 0.0f, 0.0f}, 150.0f)).empty());
+
+    const AABB query = Box({500.0f, 0.0f, 0.0f}, 50.0f);
+    ASSERT_EQ(BruteForceOverlaps(query), QueryOverlaps(query));
+
+    // Small moves stay inside the fattened box
+    ASSERT_FALSE(mBVH.Update(GameObjectId {1, 0}, Box(mBoxes[1].GetCenter(), 1.05f)));
+}
+
+TEST_F(DynamicBVHTests, StaleGenerationIsReplaced)
+{
+    mBVH.Insert(GameObjectId {3, 1}, Box({0.0f, 0.0f, 0.0f}, 1.0f));
+
+    ASSERT_FALSE(mBVH.Contains(GameObjectId {3, 0}));
+    ASSERT_TRUE(mBVH.Contains(GameObjectId {3, 1}));
+    ASSERT_EQ(kNumObjects, mBVH.GetSize());
+}
+
+TEST_F(DynamicBVHTests, RaycastClosestIsTheNearestHit)
+{
+    // Aimed through the first box, so there's at least one hit
+    const Vec3 origin = {-200.0f, 0.0f, 0.0f};
+    const Vec3 target = mBoxes[0].GetCenter();
+    const Vec3 direction = {target.x - origin.x, target.y - origin.y, target.z - origin.z};
+
+    std::vector<DynamicBVH::RayHit> hits(kNumObjects);
+    const size_t count = mBVH.Raycast(origin, direction, 10.0f, hits);
+    ASSERT_GT(count, 0);
+
+    const std::optional<DynamicBVH::RayHit> closest =
+        mBVH.RaycastClosest(origin, direction, 10.0f);
+    ASSERT_TRUE(closest.has_value());
+
+    const auto nearest = std::min_element(hits.begin(),
+                                          hits.begin() + count,
+                                          [](const auto& a, const auto& b) {
+                                              return a.distance < b.distance;
+                                          });
+    ASSERT_EQ(nearest->goId.sparseIndex, closest->goId.sparseIndex);
+    ASSERT_EQ(nearest->distance, closest->distance);
+
+    // Every hit box really is on the ray
+    for(size_t i = 0; i < count; i++)
+    {
+        const float t = hits[i].distance;
+        const Vec3 point = {origin.x + direction.x * t,
+                            origin.y + direction.y * t,
+                            origin.z + direction.z * t};
+        ASSERT_TRUE(Box(point, 1e-3f).Overlaps(mBoxes[hits[i].goId.sparseIndex]));
+    }
+
+    ASSERT_FALSE(mBVH.RaycastClosest(origin, {-1.0f, 0.0f, 0.0f}, 1000.0f).has_value());
+}
+
+TEST_F(DynamicBVHTests, FrustumQueryMatchesBruteForce)
+{
+    // Camera at the origin looking down -z, 90 degree FOV, reversed Z
+    Mat44 projection;
+    projection.Set<0, 0>(1.0f);
+    projection.Set<1, 1>(1.0f);
+    projection.Set<2, 2>(0.1f / (1000.0f - 0.1f));
+    projection.Set<2, 3>(-1.0f);
+    projection.Set<3, 2>((1000.0f * 0.1f) / (1000.0f - 0.1f));
+
+    const Frustum frustum = Frustum::FromViewProjection(projection);
+
+    std::vector<GameObjectId> out(kNumObjects);
+    const size_t count = mBVH.QueryFrustum(frustum, out);
+
+    std::set<uint32_t> expected;
+    for(uint32_t i = 0; i < kNumObjects; i++)
+    {
+        if(frustum.Intersects(mBoxes[i]))
+            expected.insert(i);
+    }
+
+    std::set<uint32_t> actual;
+    for(size_t i = 0; i < count; i++)
+        actual.insert(out[i].sparseIndex);
+
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(expected, actual);
+}
+
+TEST(SpatialSystemTests, FollowsTransformChanges)
+{
+    ECSRegistry registry {ComponentManifest<TransformComponent, BoundsComponent> {}};
+    SpatialSystem spatial;
+
+    const AABB unitBox = Box({0.0f, 0.0f, 0.0f}, 1.0f);
+
+    const GameObjectId a = registry.CreateGameObject();
+    registry.CreateComponent<TransformComponent>(a, nullptr, Transform {});
+    registry.CreateComponent<BoundsComponent>(a, unitBox);
+
+    const GameObjectId b = registry.CreateGameObject();
+    registry.CreateComponent<TransformComponent>(b, nullptr, Transform {});
+    registry.CreateComponent<BoundsComponent>(b, unitBox);
+
+    spatial.Process(registry);
+    ASSERT_EQ(2, spatial.GetBVH().GetSize());
+
+    registry.GetComponent<TransformComponent>(a)->localToParentTransform.translation = {50, 0, 0};
+    spatial.Process(registry);
+
+    std::vector<GameObjectId> out(2);
+    ASSERT_EQ(1, spatial.GetBVH().QueryOverlaps(Box({50.0f, 0.0f, 0.0f}, 0.5f), out));
+    ASSERT_EQ(a.sparseIndex, out[0].sparseIndex);
+}
+
+} // namespace core_tests
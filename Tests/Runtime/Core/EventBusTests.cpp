@@ -0,0 +1,139 @@
+// Library Headers
+#include <gtest/gtest.h>
+
+// STD Headers
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+import sj.engine.core.EventBus;
+
+using namespace sj;
+
+namespace core_tests
+{
+
+struct KeyEvent
+{
+    int key = 0;
+};
+
+struct MotionEvent
+{
+    float dx = 0.0f;
+    float dy = 0.0f;
+};
+
+struct EventLog
+{
+    EventBus* bus = nullptr;
+    std::vector<int> keys;
+    std::vector<size_t> keyBatchSizes;
+    size_t motionCount = 0;
+    int requeueKey = -1;
+};
+
+void DrainKeys(void* context, std::span<const KeyEvent> events)
+{
+    EventLog& log = *static_cast<EventLog*>(context);
+    log.keyBatchSizes.push_back(events.size());
+
+    for(const KeyEvent& evt : events)
+    {
+        log.keys.push_back(evt.key);
+
+        if(evt.key == log.requeueKey)
+            log.bus->Enqueue<&DrainKeys>(KeyEvent {.key = evt.key + 1000});
+    }
+}
+
+void DrainMotion(void* context, std::span<const MotionEvent> events)
+{
+    static_cast<EventLog*>(context)->motionCount += events.size();
+}
+
+class EventBusTests : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Small frame buffer so bursts exercise the overflow path
+        mBus.Init(std::pmr::new_delete_resource(), 256);
+        mLog.bus = &mBus;
+    }
+
+    void TearDown() override
+    {
+        mBus.DeInit();
+    }
+
+    EventBus mBus;
+    EventLog mLog;
+};
+
+TEST_F(EventBusTests, DispatchDeliversOneBatchPerType)
+{
+    for(int i = 0; i < 100; i++)
+        mBus.Enqueue<&DrainKeys>(KeyEvent {.key = i});
+
+    for(int i = 0; i < 1000; i++)
+        mBus.Enqueue<&DrainMotion>(MotionEvent {.dx = 1.0f});
+
+    ASSERT_EQ(1100, mBus.GetNumQueuedEvents());
+
+    mBus.Dispatch(&mLog);
+
+    ASSERT_EQ(1, mLog.keyBatchSizes.size());
+    ASSERT_EQ(100, mLog.keyBatchSizes[0]);
+    ASSERT_EQ(1000, mLog.motionCount);
+    ASSERT_EQ(0, mBus.GetNumQueuedEvents());
+
+    // Order within a type is preserved
+    for(int i = 0; i < 100; i++)
+        ASSERT_EQ(i, mLog.keys[i]);
+}
+
+TEST_F(EventBusTests, EmptyDispatchDoesNothing)
+{
+    mBus.Dispatch(&mLog);
+
+    ASSERT_TRUE(mLog.keyBatchSizes.empty());
+    ASSERT_EQ(0, mLog.motionCount);
+}
+
+TEST_F(EventBusTests, EventsQueuedDuringDispatchAreDeferred)
+{
+    mLog.requeueKey = 2;
+
+    for(int i = 0; i < 4; i++)
+        mBus.Enqueue<&DrainKeys>(KeyEvent {.key = i});
+
+    mBus.Dispatch(&mLog);
+
+    ASSERT_EQ(4, mLog.keys.size());
+    ASSERT_EQ(1, mBus.GetNumQueuedEvents());
+
+    mBus.Dispatch(&mLog);
+
+    ASSERT_EQ(5, mLog.keys.size());
+    ASSERT_EQ(1002, mLog.keys.back());
+    ASSERT_EQ(0, mBus.GetNumQueuedEvents());
+}
+
+TEST_F(EventBusTests, FramesAreReusedAfterDispatch)
+{
+    for(int frame = 0; frame < 8; frame++)
+    {
+        for(int i = 0; i < 64; i++)
+            mBus.Enqueue<&DrainKeys>(KeyEvent {.key = frame});
+
+        mBus.Dispatch(&mLog);
+    }
+
+    ASSERT_EQ(8, mLog.keyBatchSizes.size());
+    ASSERT_EQ(8 * 64, mLog.keys.size());
+    ASSERT_EQ(7, mLog.keys.back());
+}
+
+} // namespace core_tests
@@ -0,0 +1,231 @@
+// Library Headers
+#include <gtest/gtest.h>
+
+// STD Headers
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+import sj.engine.core.BoundsComponent;
+import sj.engine.core.OccluderComponent;
+import sj.engine.core.TransformComponent;
+import sj.engine.ecs;
+import sj.engine.rendering.OcclusionBuffer;
+import sj.engine.rendering.OcclusionCullingSystem;
+import sj.std.math;
+
+using namespace sj;
+
+namespace rendering_tests
+{
+
+AABB Box(const Vec3& center, float extent)
+{
+    return {.min = {center.x - extent, center.y - extent, center.z - extent},
+            .max = {center.x + extent, center.y + extent, center.z + extent}};
+}
+
+// Camera at the origin looking down -z, 90 degree vertical FOV, 2:1 aspect. Reversed Z
+Mat44 ViewProjection()
+{
+    constexpr float near = 1000.0f;
+    constexpr float far = 0.1f;
+
+    Mat44 res;
+    res.Set<0, 0>(0.5f);
+    res.Set<1, 1>(1.0f);
+    res.Set<2, 2>(far / (near - far));
+    res.Set<2, 3>(-1.0f);
+    res.Set<3, 2>((near * far) / (near - far));
+    return res;
+}
+
+// 10x10 wall facing the camera, 10 units away
+const std::vector<Vec3> kWallPositions = {{-5, -5, -10}, {5, -5, -10}, {5, 5, -10}, {-5, 5, -10}};
+const std::vector<uint16_t> kWallIndices = {0, 1, 2, 0, 2, 3};
+
+class OcclusionBufferTests : public ::testing::Test
+{
+protected:
+    void DrawWall()
+    {
+        mBuffer.Begin(ViewProjection());
+        mBuffer.AddOccluder(kWallPositions, kWallIndices, Mat44(kIdentityTag));
+        mBuffer.Rasterize();
+    }
+
+    OcclusionBuffer mBuffer;
+};
+
+TEST_F(OcclusionBufferTests, EmptyBufferHidesNothing)
+{
+    mBuffer.Begin(ViewProjection());
+    mBuffer.Rasterize();
+
+    ASSERT_TRUE(mBuffer.IsVisible(Box({0.0f, 0.0f, -20.0f}, 1.0f)));
+}
+
+TEST_F(OcclusionBufferTests, WallHidesWhatIsBehindIt)
+{
+    DrawWall();
+    ASSERT_EQ(2, mBuffer.GetNumTriangles());
+
+    // Depth is 1/w, and w is the distance down -z
+    const float centerDepth = mBuffer.GetDepth(mBuffer.GetWidth() / 2, mBuffer.GetHeight() / 2);
+    ASSERT_NEAR(0.1f, centerDepth, 1e-4f);
+    ASSERT_EQ(0.0f, mBuffer.GetDepth(0, 0));
+
+    ASSERT_FALSE(mBuffer.IsVisible(Box({0.0f, 0.0f, -20.0f}, 1.0f)));
+    ASSERT_FALSE(mBuffer.IsVisible(Box({7.0f, 0.0f, -20.0f}, 1.0f)));
+}
+
+TEST_F(OcclusionBufferTests, UncoveredBoxesStayVisible)
+{
+    DrawWall();
+
+    // In front, beside, poking through, and peeking past the edge. The wall's edge at x = 5
+    // projects to x = 10 at z = -20
+    ASSERT_TRUE(mBuffer.IsVisible(Box({0.0f, 0.0f, -5.0f}, 1.0f)));
+    ASSERT_TRUE(mBuffer.IsVisible(Box({20.0f, 0.0f, -20.0f}, 1.0f)));
+    ASSERT_TRUE(mBuffer.IsVisible(Box({0.0f, 0.0f, -10.0f}, 1.0f)));
+    ASSERT_TRUE(mBuffer.IsVisible(Box({9.0f, 0.0f, -20.0f}, 1.5f)));
+
+    // Reaches behind the camera, so it can't be projected
+    ASSERT_TRUE(mBuffer.IsVisible(Box({0.0f, 0.0f, 0.0f}, 1.0f)));
+}
+
+TEST_F(OcclusionBufferTests, SubdividedWallHasNoCracks)
+{
+    // Same wall split into a grid, so pixel centers land exactly on shared diagonals
+    constexpr int kCells = 13;
+
+    std::vector<Vec3> positions;
+    for(int y = 0; y <= kCells; y++)
+    {
+        for(int x = 0; x <= kCells; x++)
+        {
+            positions.push_back({-5.0f + 10.0f * static_cast<float>(x) / kCells,
+                                 -5.0f + 10.0f * static_cast<float>(y) / kCells,
+                                 -10.0f});
+        }
+    }
+
+    std::vector<uint16_t> indices;
+    for(int y = 0; y < kCells; y++)
+    {
+        for(int x = 0; x < kCells; x++)
+        {
+            const auto a = static_cast<uint16_t>(y * (kCells + 1) + x);
+            const auto b = static_cast<uint16_t>(a + 1);
+            const auto c = static_cast<uint16_t>(a + kCells + 1);
+            const auto d = static_cast<uint16_t>(c + 1);
+            indices.insert(indices.end(), {a, b, d, a, d, c});
+        }
+    }
+
+    mBuffer.Begin(ViewProjection());
+    mBuffer.AddOccluder(positions, indices, Mat44(kIdentityTag));
+    mBuffer.Rasterize();
+
+    // The wall covers the middle 64x64 pixels
+    const uint32_t centerX = mBuffer.GetWidth() / 2;
+    const uint32_t centerY = mBuffer.GetHeight() / 2;
+    for(uint32_t y = centerY - 24; y < centerY + 24; y++)
+    {
+        for(uint32_t x = centerX - 24; x < centerX + 24; x++)
+            ASSERT_GT(mBuffer.GetDepth(x, y), 0.0f) << x << ", " << y;
+    }
+}
+
+TEST_F(OcclusionBufferTests, WallReachingBehindCameraIsClipped)
+{
+    // Side wall running from behind the camera to 40 units ahead, 3 units to the left
+    const std::vector<Vec3> positions = {{-3, -5, 10}, {-3, -5, -40}, {-3, 5, -40}, {-3, 5, 10}};
+
+    mBuffer.Begin(ViewProjection());
+    mBuffer.AddOccluder(positions, kWallIndices, Mat44(kIdentityTag));
+    mBuffer.Rasterize();
+
+    // One triangle loses a corner and becomes two, the other loses two corners
+    ASSERT_EQ(3, mBuffer.GetNumTriangles());
+
+    // Three eighths of the way across, the view ray meets the wall about 6 units away
+    const uint32_t x = mBuffer.GetWidth() * 3 / 8;
+    ASSERT_NEAR(1.0f / 6.0f, mBuffer.GetDepth(x, mBuffer.GetHeight() / 2), 1e-2f);
+
+    ASSERT_FALSE(mBuffer.IsVisible(Box({-20.0f, 0.0f, -20.0f}, 1.0f)));
+    ASSERT_TRUE(mBuffer.IsVisible(Box({-1.5f, 0.0f, -10.0f}, 0.5f)));
+    ASSERT_TRUE(mBuffer.IsVisible(Box({20.0f, 0.0f, -20.0f}, 1.0f)));
+}
+
+TEST_F(OcclusionBufferTests, OccluderTransformIsApplied)
+{
+    // Moved well off to the side, the wall hides nothing in the middle
+    mBuffer.Begin(ViewProjection());
+    mBuffer.AddOccluder(kWallPositions,
+                        kWallIndices,
+                        Transform {.translation = {100.0f, 0.0f, 0.0f}}.ToMat44());
+    mBuffer.Rasterize();
+
+    ASSERT_TRUE(mBuffer.IsVisible(Box({0.0f, 0.0f, -20.0f}, 1.0f)));
+}
+
+TEST_F(OcclusionBufferTests, CullOccludedCompactsInPlace)
+{
+    DrawWall();
+
+    const std::vector<AABB> boxes = {Box({0.0f, 0.0f, -20.0f}, 1.0f),
+                                     Box({0.0f, 0.0f, -5.0f}, 1.0f),
+                                     Box({1.0f, 1.0f, -50.0f}, 2.0f),
+                                     Box({30.0f, 0.0f, -50.0f}, 2.0f)};
+
+    std::vector<uint32_t> candidates = {0, 1, 2, 3};
+    const size_t numVisible = mBuffer.CullOccluded(boxes, candidates, candidates);
+
+    ASSERT_EQ(2, numVisible);
+    ASSERT_EQ(1, candidates[0]);
+    ASSERT_EQ(3, candidates[1]);
+}
+
+TEST(OcclusionCullingSystemTests, OccludersHideCandidates)
+{
+    ECSRegistry registry {
+        ComponentManifest<TransformComponent, BoundsComponent, OccluderComponent> {}};
+
+    const GameObjectId wall = registry.CreateGameObject();
+    registry.CreateComponent<TransformComponent>(wall, nullptr, Transform {});
+    registry.CreateComponent<BoundsComponent>(wall, Box({0.0f, 0.0f, -10.0f}, 5.0f));
+
+    OccluderComponent occluder;
+    occluder.positions.insert(occluder.positions.end(),
+                              kWallPositions.begin(),
+                              kWallPositions.end());
+    occluder.indices.insert(occluder.indices.end(), kWallIndices.begin(), kWallIndices.end());
+    registry.CreateComponent<OccluderComponent>(wall, std::move(occluder));
+
+    const GameObjectId hidden = registry.CreateGameObject();
+    registry.CreateComponent<TransformComponent>(
+        hidden,
+        nullptr,
+        Transform {.translation = {0.0f, 0.0f, -20.0f}});
+    registry.CreateComponent<BoundsComponent>(hidden, Box({0.0f, 0.0f, 0.0f}, 1.0f));
+
+    const GameObjectId noBounds = registry.CreateGameObject();
+    registry.CreateComponent<TransformComponent>(
+        noBounds,
+        nullptr,
+        Transform {.translation = {0.0f, 0.0f, -20.0f}});
+
+    const GameObjectId candidates[] = {wall, hidden, noBounds};
+
+    OcclusionCullingSystem occlusion;
+    occlusion.Process(registry, ViewProjection(), candidates);
+
+    const auto visible = occlusion.GetVisibleGameObjects();
+    ASSERT_EQ(2, visible.size());
+    ASSERT_EQ(wall.sparseIndex, visible[0].sparseIndex);
+    ASSERT_EQ(noBounds.sparseIndex, visible[1].sparseIndex);
+}
+
+} // namespace rendering_tests
@@ -0,0 +1,110 @@
+// Library Headers
+#include <gtest/gtest.h>
+
+// STD Headers
+#include <array>
+#include <cstring>
+#include <memory_resource>
+
+import sj.engine.system.memory;
+import sj.std.memory.resources;
+
+using namespace sj;
+
+#ifndef SJ_GOLD
+namespace system_tests
+{
+
+TEST(AllocationTrackerTests, AttachedResourceReportsAllocations)
+{
+    system_allocator host;
+    free_list_allocator heap(4096, host);
+    heap.set_debug_name("Tracked Heap");
+
+    AllocationTracker tracker;
+    tracker.Attach(&heap);
+    ASSERT_TRUE(tracker.IsAttached(&heap));
+
+    void* a = heap.allocate(64);
+    void* b = heap.allocate(128);
+
+    ASSERT_EQ(2, tracker.GetLiveAllocationCount());
+    ASSERT_EQ(192, tracker.GetLiveBytes());
+
+    heap.deallocate(a, 64);
+    ASSERT_EQ(1, tracker.GetLiveAllocationCount());
+    ASSERT_EQ(128, tracker.GetLiveBytes());
+
+    heap.deallocate(b, 128);
+    ASSERT_EQ(0, tracker.GetLiveAllocationCount());
+
+    heap.set_allocation_listener(nullptr);
+}
+
+TEST(AllocationTrackerTests, SitesGroupedByTag)
+{
+    system_allocator host;
+    free_list_allocator heap(4096, host);
+    heap.set_debug_name("Tracked Heap");
+
+    AllocationTracker tracker;
+    tracker.Attach(&heap);
+
+    void* untagged = heap.allocate(16);
+
+    void* tagged[3] = {};
+    {
+        MemoryTagScope tag("Textures");
+        ASSERT_EQ(0, std::strcmp("Textures", AllocationTracker::GetCurrentTag()));
+
+        for(void*& ptr : tagged)
+            ptr = heap.allocate(100);
+    }
+    ASSERT_EQ(nullptr, AllocationTracker::GetCurrentTag());
+
+    std::array<AllocationTracker::AllocationSite, 4> sites;
+    size_t numSites = tracker.CollectTopSites(sites);
+
+    // Callstack sampling may split a tag across sites, so aggregate by tag
+    size_t texturesBytes = 0;
+    size_t heapBytes = 0;
+    for(size_t i = 0; i < numSites; i++)
+    {
+        if(std::strcmp(sites[i].tag, "Textures") == 0)
+            texturesBytes += sites[i].totalBytes;
+        else if(std::strcmp(sites[i].tag, "Tracked Heap") == 0)
+            heapBytes += sites[i].totalBytes;
+    }
+
+    ASSERT_EQ(300, texturesBytes);
+    ASSERT_EQ(16, heapBytes);
+    ASSERT_EQ(0, std::strcmp("Textures", sites[0].tag));
+
+    for(void* ptr : tagged)
+        heap.deallocate(ptr, 100);
+    heap.deallocate(untagged, 16);
+
+    ASSERT_EQ(0, tracker.GetLiveAllocationCount());
+    heap.set_allocation_listener(nullptr);
+}
+
+TEST(AllocationTrackerTests, ManualRecording)
+{
+    AllocationTracker tracker;
+
+    int dummy[4] = {};
+    tracker.RecordAllocation(&dummy[0], sizeof(int));
+    tracker.RecordAllocation(&dummy[1], sizeof(int));
+    ASSERT_EQ(2, tracker.GetLiveAllocationCount());
+
+    std::array<AllocationTracker::AllocationSite, 1> sites;
+    ASSERT_EQ(1, tracker.CollectTopSites(sites));
+    ASSERT_EQ(0, std::strcmp(AllocationTracker::kUntagged, sites[0].tag));
+
+    tracker.RecordDeallocation(&dummy[0]);
+    tracker.RecordDeallocation(&dummy[1]);
+    ASSERT_EQ(0, tracker.GetLiveAllocationCount());
+}
+
+} // namespace system_tests
+#endif // !SJ_GOLD
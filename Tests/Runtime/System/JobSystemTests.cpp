@@ -0,0 +1,203 @@
+// Library Headers
+#include <gtest/gtest.h>
+
+// STD Headers
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+import sj.engine.system.threading;
+
+using namespace sj;
+
+namespace system_tests
+{
+
+TEST(WorkStealingDequeTests, OwnerPopsLifoThievesStealFifo)
+{
+    WorkStealingDeque<int, 8> deque;
+
+    for(int i = 0; i < 8; i++)
+        ASSERT_TRUE(deque.Push(i));
+
+    ASSERT_FALSE(deque.Push(8));
+    ASSERT_EQ(8, deque.Size());
+
+    ASSERT_EQ(7, deque.Pop());
+    ASSERT_EQ(0, deque.Steal());
+    ASSERT_EQ(1, deque.Steal());
+    ASSERT_EQ(6, deque.Pop());
+    ASSERT_EQ(4, deque.Size());
+
+    while(deque.Pop())
+        ;
+
+    ASSERT_TRUE(deque.Empty());
+    ASSERT_EQ(std::nullopt, deque.Pop());
+    ASSERT_EQ(std::nullopt, deque.Steal());
+}
+
+TEST(WorkStealingDequeTests, ConcurrentStealsSeeEachElementOnce)
+{
+    constexpr int kNumElements = 1024;
+    WorkStealingDeque<int, 1024> deque;
+    std::vector<std::atomic<int>> seen(kNumElements);
+
+    for(int i = 0; i < kNumElements; i++)
+        deque.Push(i);
+
+    std::atomic<bool> go = false;
+    std::vector<std::thread> thieves;
+    for(int t = 0; t < 3; t++)
+    {
+        thieves.emplace_back([&]() {
+            while(!go)
+                ;
+
+            while(!deque.Empty())
+            {
+                if(std::optional<int> value = deque.Steal())
+                    seen[*value]++;
+            }
+        });
+    }
+
+    go = true;
+    while(std::optional<int> value = deque.Pop())
+        seen[*value]++;
+
+    for(std::thread& thief : thieves)
+        thief.join();
+
+    for(const std::atomic<int>& count : seen)
+        ASSERT_EQ(1, count.load());
+}
+
+TEST(JobSystemTests, RunsAllJobs)
+{
+    constexpr int kNumJobs = 1000;
+
+    std::atomic<int> sum = 0;
+    JobCounter counter;
+
+    for(int i = 1; i <= kNumJobs; i++)
+    {
+        JobSystem::Schedule([&sum, i]() { sum += i; }, &counter);
+    }
+
+    JobSystem::Wait(counter);
+
+    ASSERT_TRUE(counter.IsDone());
+    ASSERT_EQ(kNumJobs * (kNumJobs + 1) / 2, sum.load());
+}
+
+TEST(JobSystemTests, MoreJobsThanPoolSlots)
+{
+    // Without waiting in between, so later jobs find their ring slots still occupied
+    constexpr int kNumJobs = static_cast<int>(JobSystem::kJobPoolSize) * 3;
+
+    std::atomic<int> count = 0;
+    JobCounter counter;
+
+    for(int i = 0; i < kNumJobs; i++)
+        JobSystem::Schedule([&count]() { count++; }, &counter);
+
+    JobSystem::Wait(counter);
+    ASSERT_EQ(kNumJobs, count.load());
+}
+
+TEST(JobSystemTests, CounterCanBeDestroyedRightAfterWait)
+{
+    // The last job must be done with the counter by the time Wait returns
+    for(int i = 0; i < 1000; i++)
+    {
+        std::atomic<int> count = 0;
+        auto counter = std::make_unique<JobCounter>();
+
+        for(int j = 0; j < 3; j++)
+            JobSystem::Schedule([&count]() { count++; }, counter.get());
+
+        JobSystem::Wait(*counter);
+        counter.reset();
+
+        ASSERT_EQ(3, count.load());
+    }
+}
+
+TEST(JobSystemTests, NestedJobsAndScratchpad)
+{
+    constexpr int kNumOuter = 16;
+    constexpr int kNumInner = 16;
+
+    std::atomic<int> count = 0;
+    JobCounter outerCounter;
+
+    for(int i = 0; i < kNumOuter; i++)
+    {
+        JobSystem::Schedule(
+            [&count]() {
+                // Every job system thread has a scratchpad
+                auto scratchpad = ThreadContext::GetScratchpad();
+                void* memory = scratchpad.get_allocator().allocate(128);
+                EXPECT_NE(nullptr, memory);
+
+                JobCounter innerCounter;
+                for(int j = 0; j < kNumInner; j++)
+                    JobSystem::Schedule([&count]() { count++; }, &innerCounter);
+
+                JobSystem::Wait(innerCounter);
+            },
+            &outerCounter);
+    }
+
+    JobSystem::Wait(outerCounter);
+    ASSERT_EQ(kNumOuter * kNumInner, count.load());
+}
+
+TEST(JobSystemTests, DeInitDestroysQueuedJobs)
+{
+    constexpr int kNumJobs = 64;
+    const uint32_t numWorkers = JobSystem::GetNumThreads() - 1;
+
+    // Park every worker so the jobs below stay queued
+    std::atomic<uint32_t> parked = 0;
+    std::atomic<bool> release = false;
+    for(uint32_t i = 0; i < numWorkers; i++)
+    {
+        JobSystem::Schedule([&parked, &release]() {
+            parked++;
+            while(!release)
+                std::this_thread::yield();
+        });
+    }
+
+    while(parked < numWorkers)
+        std::this_thread::yield();
+
+    std::atomic<int> ran = 0;
+    auto token = std::make_shared<int>(0);
+    for(int i = 0; i < kNumJobs; i++)
+        JobSystem::Schedule([token, &ran]() { ran++; });
+
+    ASSERT_EQ(kNumJobs + 1, token.use_count());
+
+    // Unpark the workers once DeInit has told them to stop
+    std::thread releaser([&release]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        release = true;
+    });
+
+    JobSystem::DeInit();
+    releaser.join();
+
+    EXPECT_EQ(0, ran.load());
+    EXPECT_EQ(1, token.use_count());
+
+    JobSystem::Init(numWorkers);
+}
+
+} // namespace system_tests
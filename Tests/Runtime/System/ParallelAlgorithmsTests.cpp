@@ -0,0 +1,121 @@
+// Library Headers
+#include <gtest/gtest.h>
+
+// STD Headers
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+import sj.engine.system.memory;
+import sj.engine.system.threading;
+
+using namespace sj;
+
+namespace system_tests
+{
+
+TEST(ParallelAlgorithmsTests, ParallelForVisitsEachIndexOnce)
+{
+    constexpr size_t kCount = 10000;
+    std::vector<std::atomic<int>> visits(kCount);
+
+    ParallelFor(kCount, [&visits](size_t i) { visits[i]++; });
+
+    for(const std::atomic<int>& count : visits)
+        ASSERT_EQ(1, count.load());
+
+    // Explicit grain size and the span overload
+    std::vector<int> values(kCount, 1);
+    ParallelFor(std::span(values), [](int& value) { value *= 3; }, 7);
+    ASSERT_TRUE(std::ranges::all_of(values, [](int value) { return value == 3; }));
+}
+
+TEST(ParallelAlgorithmsTests, ParallelReduceMatchesSerial)
+{
+    std::vector<uint64_t> values(50000);
+    std::iota(values.begin(), values.end(), 0);
+
+    const uint64_t sum = ParallelReduce(std::span(values), uint64_t(0));
+    ASSERT_EQ(std::accumulate(values.begin(), values.end(), uint64_t(0)), sum);
+
+    const uint64_t max = ParallelReduce(
+        values.size(),
+        uint64_t(0),
+        [&values](size_t i) { return values[i] * 2; },
+        [](uint64_t a, uint64_t b) { return std::max(a, b); });
+    ASSERT_EQ(values.back() * 2, max);
+
+    ASSERT_EQ(42, ParallelReduce(std::span<int>(), 42));
+}
+
+TEST(ParallelAlgorithmsTests, ParallelInclusiveScanMatchesSerial)
+{
+    std::vector<int> values(20000);
+    std::mt19937 rng(7);
+    for(int& value : values)
+        value = static_cast<int>(rng() % 100);
+
+    std::vector<int64_t> expected(values.size());
+    std::inclusive_scan(values.begin(), values.end(), expected.begin(), std::plus<>(), int64_t(0));
+
+    std::vector<int64_t> scanned(values.size());
+    ParallelInclusiveScan(std::span(values), std::span(scanned), int64_t(0));
+    ASSERT_EQ(expected, scanned);
+
+    // In place
+    std::vector<int64_t> inPlace(values.begin(), values.end());
+    ParallelInclusiveScan(std::span(inPlace), std::span(inPlace), int64_t(0));
+    ASSERT_EQ(expected, inPlace);
+}
+
+TEST(ParallelAlgorithmsTests, ParallelSortIsSortedAndStable)
+{
+    // Few distinct keys so stability is observable through the payload
+    std::vector<std::pair<int, int>> values(20000);
+    std::mt19937 rng(11);
+    for(int i = 0; auto& [key, order] : values)
+    {
+        key = static_cast<int>(rng() % 64);
+        order = i++;
+    }
+
+    std::vector<std::pair<int, int>> expected = values;
+    auto byKey = [](const auto& a, const auto& b) { return a.first < b.first; };
+    std::ranges::stable_sort(expected, byKey);
+
+    ParallelSort(std::span(values), byKey);
+    ASSERT_EQ(expected, values);
+
+    // Odd chunk counts leave a run without a partner on some passes
+    std::vector<int> small = {5, 3, 9, 1, 7, 2, 8, 6, 4, 0, 11};
+    ParallelSort(std::span(small), std::less<>(), 3);
+    ASSERT_TRUE(std::ranges::is_sorted(small));
+}
+
+#ifndef SJ_GOLD
+TEST(ParallelAlgorithmsTests, ParallelSortNeverCallsGlobalNew)
+{
+    std::vector<int> values(50000);
+    std::mt19937 rng(5);
+    for(int& value : values)
+        value = static_cast<int>(rng() % 1000);
+
+    std::vector<int> serial(values.begin(), values.begin() + 100);
+
+    const size_t globalNewsBefore = MemorySystem::GetGlobalNewCount();
+    ParallelSort(std::span(values));
+    ParallelSort(std::span(serial));
+    const size_t globalNewsAfter = MemorySystem::GetGlobalNewCount();
+
+    ASSERT_EQ(globalNewsBefore, globalNewsAfter);
+    ASSERT_TRUE(std::ranges::is_sorted(values));
+    ASSERT_TRUE(std::ranges::is_sorted(serial));
+}
+#endif // !SJ_GOLD
+
+} // namespace system_tests
@@ -0,0 +1,98 @@
+// Library Headers
+#include <gtest/gtest.h>
+
+// STD Headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+import sj.engine.system.threading;
+
+using namespace sj;
+
+namespace system_tests
+{
+
+task<int> AddAsync(int a, int b)
+{
+    co_return a + b;
+}
+
+task<int> SumChainAsync(int depth)
+{
+    if(depth == 0)
+        co_return 0;
+
+    const int rest = co_await SumChainAsync(depth - 1);
+    co_return co_await AddAsync(depth, rest);
+}
+
+TEST(TaskTests, AwaitChildTasks)
+{
+    ASSERT_EQ(7, TaskScheduler::SyncWait(AddAsync(3, 4)));
+    ASSERT_EQ(55, TaskScheduler::SyncWait(SumChainAsync(10)));
+}
+
+TEST(TaskTests, AwaitJobCounter)
+{
+    std::atomic<int> count = 0;
+
+    auto fanOut = [](std::atomic<int>& out) -> task<int> {
+        JobCounter counter;
+        for(int i = 0; i < 64; i++)
+            JobSystem::Schedule([&out]() { out++; }, &counter);
+
+        co_await counter;
+        co_return out.load();
+    };
+
+    ASSERT_EQ(64, TaskScheduler::SyncWait(fanOut(count)));
+}
+
+TEST(TaskTests, NextFrameResumesOnMainThread)
+{
+    auto hop = []() -> task<uint32_t> {
+        co_await ResumeOnWorker {};
+        co_await NextFrame {};
+        co_return JobSystem::GetThreadIndex();
+    };
+
+    ASSERT_EQ(0, TaskScheduler::SyncWait(hop()));
+}
+
+TEST(TaskTests, ReadFileAsync)
+{
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "sj_task_tests_read.bin";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << "screwjank";
+    }
+
+    auto read = [](std::string filePath) -> task<std::string> {
+        std::pmr::vector<std::byte> data = co_await ReadFileAsync(std::move(filePath));
+        co_return std::string(reinterpret_cast<const char*>(data.data()), data.size());
+    };
+
+    ASSERT_EQ("screwjank", TaskScheduler::SyncWait(read(path.string())));
+    ASSERT_EQ("", TaskScheduler::SyncWait(read((path / "missing").string())));
+
+    std::filesystem::remove(path);
+}
+
+TEST(TaskTests, FrameAllocatorRecyclesBlocks)
+{
+    void* first = CoroutineFrameAllocator::Allocate(200);
+    CoroutineFrameAllocator::Deallocate(first, 200);
+
+    void* second = CoroutineFrameAllocator::Allocate(250);
+    ASSERT_EQ(first, second);
+    CoroutineFrameAllocator::Deallocate(second, 250);
+}
+
+} // namespace system_tests
@@ -0,0 +1,157 @@
+// STD Headers
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Library Headers
+#include <gtest/gtest.h>
+
+import sj.std.containers.bitset;
+import sj.std.memory.resources.free_list_allocator;
+
+using namespace sj;
+
+namespace container_tests
+{
+    TEST(BitsetTests, SetTestAndCount)
+    {
+        static_bitset<100> bits;
+        ASSERT_TRUE(bits.none());
+        ASSERT_EQ(100, bits.size());
+
+        bits.set(0).set(63).set(64).set(99);
+        ASSERT_TRUE(bits.test(63));
+        ASSERT_TRUE(bits[64]);
+        ASSERT_FALSE(bits.test(65));
+        ASSERT_EQ(4, bits.count());
+
+        bits.reset(63);
+        bits.flip(1);
+        ASSERT_FALSE(bits.test(63));
+        ASSERT_TRUE(bits.test(1));
+
+        // Whole-set operations leave bits past size() alone
+        bits.set();
+        ASSERT_TRUE(bits.all());
+        ASSERT_EQ(100, bits.count());
+
+        bits.flip();
+        ASSERT_TRUE(bits.none());
+    }
+
+    TEST(BitsetTests, FindAndIterateSetBits)
+    {
+        dynamic_bitset bits(300);
+        ASSERT_EQ(dynamic_bitset::npos, bits.find_first());
+
+        const std::vector<size_t> expected = {3, 64, 65, 190, 299};
+        for(size_t bit : expected)
+            bits.set(bit);
+
+        ASSERT_EQ(3, bits.find_first());
+        ASSERT_EQ(64, bits.find_next(4));
+        ASSERT_EQ(190, bits.find_next(66));
+        ASSERT_EQ(dynamic_bitset::npos, bits.find_next(300));
+
+        std::vector<size_t> visited;
+        bits.for_each_set_bit([&visited](size_t bit) { visited.push_back(bit); });
+        ASSERT_EQ(expected, visited);
+    }
+
+    TEST(BitsetTests, FindFirstUnsetTracksFreeSlots)
+    {
+        dynamic_bitset used(130);
+        for(size_t i = 0; i < 129; i++)
+            used.set(i);
+
+        ASSERT_EQ(129, used.find_first_unset());
+
+        used.set(129);
+        ASSERT_EQ(dynamic_bitset::npos, used.find_first_unset());
+
+        used.reset(70);
+        ASSERT_EQ(70, used.find_first_unset());
+    }
+
+    TEST(BitsetTests, WordParallelOperationsMatchPerBit)
+    {
+        // Long enough to take the wide path on any word size
+        constexpr size_t kBits = 1000;
+        std::mt19937 rng(5);
+
+        dynamic_bitset a(kBits);
+        dynamic_bitset b(kBits);
+        for(size_t i = 0; i < kBits; i++)
+        {
+            a.set(i, rng() % 2);
+            b.set(i, rng() % 3 == 0);
+        }
+
+        const dynamic_bitset both = a & b;
+        const dynamic_bitset either = a | b;
+        const dynamic_bitset different = a ^ b;
+        dynamic_bitset onlyA = a;
+        onlyA.and_not(b);
+
+        for(size_t i = 0; i < kBits; i++)
+        {
+            ASSERT_EQ(a[i] && b[i], both[i]);
+            ASSERT_EQ(a[i] || b[i], either[i]);
+            ASSERT_EQ(a[i] != b[i], different[i]);
+            ASSERT_EQ(a[i] && !b[i], onlyA[i]);
+        }
+
+        ASSERT_TRUE(either.includes(a));
+        ASSERT_TRUE(a.includes(both));
+        ASSERT_FALSE(both.includes(either));
+        ASSERT_TRUE(a.intersects(either));
+        ASSERT_FALSE(onlyA.intersects(b));
+    }
+
+    TEST(BitsetTests, SignatureMatching)
+    {
+        static_bitset<64> query;
+        query.set(2).set(5);
+
+        static_bitset<64> entity;
+        entity.set(1).set(2);
+        ASSERT_FALSE(entity.includes(query));
+
+        entity.set(5);
+        ASSERT_TRUE(entity.includes(query));
+        ASSERT_EQ(query, entity & query);
+    }
+
+    TEST(BitsetTests, ResizeKeepsBitsAndUsesResource)
+    {
+        std::array<std::byte, 2048> buffer;
+        free_list_allocator resource(buffer.size(), buffer.data());
+
+        dynamic_bitset bits(70, false, &resource);
+        ASSERT_TRUE(resource.contains_ptr(bits.words()));
+
+        bits.set(3).set(69);
+        bits.resize(200, true);
+        ASSERT_TRUE(bits.test(3));
+        ASSERT_TRUE(bits.test(69));
+        ASSERT_FALSE(bits.test(68));
+        ASSERT_TRUE(bits.test(70));
+        ASSERT_TRUE(bits.test(199));
+        ASSERT_EQ(2 + 130, bits.count());
+
+        // Shrinking then growing must not resurrect old bits
+        bits.resize(10);
+        ASSERT_EQ(1, bits.count());
+        bits.resize(200);
+        ASSERT_EQ(1, bits.count());
+
+        dynamic_bitset copy = bits;
+        ASSERT_EQ(bits, copy);
+
+        dynamic_bitset moved = std::move(copy);
+        ASSERT_TRUE(moved.test(3));
+    }
+} // namespace container_tests
@@ -0,0 +1,215 @@
+// STD Headers
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Library Headers
+#include <gtest/gtest.h>
+
+import sj.std.containers.spsc_queue;
+import sj.std.containers.mpmc_queue;
+import sj.std.containers.mpsc_queue;
+import sj.std.memory.resources.free_list_allocator;
+
+using namespace sj;
+
+namespace container_tests
+{
+    TEST(ConcurrentQueueTests, SpscFillAndDrain)
+    {
+        spsc_queue<int> queue(4);
+        ASSERT_TRUE(queue.empty());
+        ASSERT_EQ(4, queue.capacity());
+
+        for(int i = 0; i < 4; i++)
+            ASSERT_TRUE(queue.try_push(i));
+
+        ASSERT_FALSE(queue.try_push(4));
+        ASSERT_EQ(4, queue.size());
+
+        for(int i = 0; i < 4; i++)
+            ASSERT_EQ(i, queue.try_pop());
+
+        ASSERT_FALSE(queue.try_pop().has_value());
+        ASSERT_TRUE(queue.empty());
+    }
+
+    TEST(ConcurrentQueueTests, SpscUsesProvidedResource)
+    {
+        std::array<std::byte, 4096> buffer;
+        free_list_allocator allocator(buffer.size(), buffer.data());
+
+        {
+            spsc_queue<std::string> queue(8, &allocator);
+            ASSERT_TRUE(queue.try_emplace("hello"));
+            ASSERT_TRUE(queue.try_push(std::string("world")));
+            ASSERT_EQ("hello", queue.try_pop());
+
+            // Remaining element is destroyed with the queue
+        }
+    }
+
+    TEST(ConcurrentQueueTests, SpscPreservesOrderAcrossThreads)
+    {
+        constexpr int kCount = 100000;
+        spsc_queue<int> queue(64);
+
+        std::thread producer([&queue]() {
+            for(int i = 0; i < kCount; i++)
+            {
+                while(!queue.try_push(i))
+                    std::this_thread::yield();
+            }
+        });
+
+        for(int expected = 0; expected < kCount;)
+        {
+            if(std::optional<int> value = queue.try_pop())
+            {
+                ASSERT_EQ(expected, *value);
+                expected++;
+            }
+        }
+
+        producer.join();
+        ASSERT_TRUE(queue.empty());
+    }
+
+    TEST(ConcurrentQueueTests, MpmcFillAndDrain)
+    {
+        mpmc_queue<int> queue(8);
+
+        for(int i = 0; i < 8; i++)
+            ASSERT_TRUE(queue.try_push(i));
+
+        ASSERT_FALSE(queue.try_push(8));
+
+        // Wrap around a few laps to exercise the sequence numbers
+        for(int lap = 0; lap < 3; lap++)
+        {
+            for(int i = 0; i < 8; i++)
+            {
+                ASSERT_EQ(i, queue.try_pop());
+                ASSERT_TRUE(queue.try_push(i));
+            }
+        }
+
+        ASSERT_EQ(8, queue.size());
+    }
+
+    TEST(ConcurrentQueueTests, MpmcManyProducersManyConsumers)
+    {
+        constexpr int kThreads = 4;
+        constexpr int kPerThread = 20000;
+        mpmc_queue<int> queue(256);
+
+        std::atomic<int> consumed = 0;
+        std::atomic<long long> sum = 0;
+        std::vector<std::thread> threads;
+
+        for(int t = 0; t < kThreads; t++)
+        {
+            threads.emplace_back([&queue]() {
+                for(int i = 1; i <= kPerThread; i++)
+                {
+                    while(!queue.try_push(i))
+                        std::this_thread::yield();
+                }
+            });
+
+            threads.emplace_back([&]() {
+                while(consumed.load() < kThreads * kPerThread)
+                {
+                    if(std::optional<int> value = queue.try_pop())
+                    {
+                        sum += *value;
+                        consumed++;
+                    }
+                }
+            });
+        }
+
+        for(std::thread& thread : threads)
+            thread.join();
+
+        const long long expected = kThreads * (static_cast<long long>(kPerThread) *
+                                               (kPerThread + 1) / 2);
+        ASSERT_EQ(expected, sum.load());
+        ASSERT_TRUE(queue.empty());
+    }
+
+    struct QueueMessage : mpsc_queue_node<QueueMessage>
+    {
+        int value = 0;
+    };
+
+    TEST(ConcurrentQueueTests, MpscIsFifo)
+    {
+        mpsc_queue<QueueMessage> queue;
+        ASSERT_TRUE(queue.empty());
+        ASSERT_EQ(nullptr, queue.try_pop());
+
+        QueueMessage messages[3];
+        for(int i = 0; i < 3; i++)
+        {
+            messages[i].value = i;
+            queue.push(&messages[i]);
+        }
+
+        for(int i = 0; i < 3; i++)
+            ASSERT_EQ(&messages[i], queue.try_pop());
+
+        ASSERT_EQ(nullptr, queue.try_pop());
+        ASSERT_TRUE(queue.empty());
+
+        // Nodes can be reused once popped
+        queue.push(&messages[1]);
+        ASSERT_EQ(&messages[1], queue.try_pop());
+    }
+
+    TEST(ConcurrentQueueTests, MpscManyProducers)
+    {
+        constexpr int kThreads = 4;
+        constexpr int kPerThread = 20000;
+
+        mpsc_queue<QueueMessage> queue;
+        std::vector<QueueMessage> messages(kThreads * kPerThread);
+        std::vector<std::thread> producers;
+
+        for(int t = 0; t < kThreads; t++)
+        {
+            producers.emplace_back([&messages, &queue, t]() {
+                for(int i = 0; i < kPerThread; i++)
+                {
+                    QueueMessage& message = messages[t * kPerThread + i];
+                    message.value = i;
+                    queue.push(&message);
+                }
+            });
+        }
+
+        // Per-producer order must be preserved
+        std::vector<int> nextExpected(kThreads, 0);
+        for(int received = 0; received < kThreads * kPerThread;)
+        {
+            QueueMessage* message = queue.try_pop();
+            if(message == nullptr)
+                continue;
+
+            const int producer = static_cast<int>((message - messages.data()) / kPerThread);
+            ASSERT_EQ(nextExpected[producer], message->value);
+            nextExpected[producer]++;
+            received++;
+        }
+
+        for(std::thread& producer : producers)
+            producer.join();
+
+        ASSERT_TRUE(queue.empty());
+    }
+} // namespace container_tests
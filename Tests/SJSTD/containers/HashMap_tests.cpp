@@ -0,0 +1,171 @@
+// STD Headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Library Headers
+#include <gtest/gtest.h>
+
+import sj.std.containers.hash_map;
+import sj.std.memory.resources.free_list_allocator;
+import sj.std.string_hash;
+
+using namespace sj;
+
+namespace container_tests
+{
+    TEST(HashMapTests, InsertFindErase)
+    {
+        dynamic_hash_map<uint32_t, std::string> map;
+        ASSERT_TRUE(map.empty());
+        ASSERT_EQ(map.end(), map.find(7u));
+
+        ASSERT_TRUE(map.emplace(7u, "seven").second);
+        ASSERT_TRUE(map.try_emplace(9u, "nine").second);
+        ASSERT_FALSE(map.emplace(7u, "SEVEN").second);
+        ASSERT_EQ("seven", map.at(7u));
+
+        map[11u] = "eleven";
+        ASSERT_EQ(3, map.size());
+        ASSERT_TRUE(map.contains(11u));
+
+        map.insert_or_assign(7u, "SEVEN");
+        ASSERT_EQ("SEVEN", map.find(7u)->second);
+
+        ASSERT_EQ(1, map.erase(9u));
+        ASSERT_EQ(0, map.erase(9u));
+        ASSERT_FALSE(map.contains(9u));
+        ASSERT_EQ(2, map.size());
+
+        map.clear();
+        ASSERT_TRUE(map.empty());
+        ASSERT_EQ(map.begin(), map.end());
+    }
+
+    TEST(HashMapTests, MatchesStdUnorderedMapUnderChurn)
+    {
+        std::mt19937 rng(1234);
+        dynamic_hash_map<uint32_t, uint32_t> map;
+        std::unordered_map<uint32_t, uint32_t> reference;
+
+        for(int i = 0; i < 50000; i++)
+        {
+            const uint32_t key = rng() % 2000;
+            if(rng() % 3 == 0)
+            {
+                ASSERT_EQ(reference.erase(key), map.erase(key));
+            }
+            else
+            {
+                ASSERT_EQ(reference.try_emplace(key, key * 3).second,
+                          map.try_emplace(key, key * 3).second);
+            }
+
+            ASSERT_EQ(reference.size(), map.size());
+        }
+
+        size_t visited = 0;
+        for(const auto& [key, value] : map)
+        {
+            ASSERT_EQ(reference.at(key), value);
+            visited++;
+        }
+        ASSERT_EQ(reference.size(), visited);
+    }
+
+    TEST(HashMapTests, EraseWhileIterating)
+    {
+        dynamic_hash_map<int, int> map;
+        for(int i = 0; i < 100; i++)
+            map[i] = i;
+
+        for(auto it = map.begin(); it != map.end();)
+        {
+            if(it->first % 2 == 1)
+                it = map.erase(it);
+            else
+                ++it;
+        }
+
+        ASSERT_EQ(50, map.size());
+        for(const auto& [key, value] : map)
+            ASSERT_EQ(0, key % 2);
+    }
+
+    TEST(HashMapTests, StringHashHeterogeneousLookup)
+    {
+        dynamic_hash_map<string_hash, float> map;
+        map["MoveForward"] = 1.0f;
+        map[string_hash("MoveRight")] = 2.0f;
+
+        ASSERT_EQ(1.0f, map.at("MoveForward"));
+        ASSERT_EQ(2.0f, map.find(std::string_view("MoveRight"))->second);
+        ASSERT_TRUE(map.contains("MoveRight"_strhash));
+        ASSERT_FALSE(map.contains("Jump"));
+    }
+
+    TEST(HashMapTests, UsesProvidedResource)
+    {
+        std::array<std::byte, 8192> buffer;
+        free_list_allocator resource(buffer.size(), buffer.data());
+
+        {
+            dynamic_hash_map<int, int> map(&resource);
+            for(int i = 0; i < 64; i++)
+                map[i] = i * i;
+
+            ASSERT_TRUE(resource.contains_ptr(&map.at(10)));
+
+            dynamic_hash_map<int, int> moved = std::move(map);
+            ASSERT_TRUE(map.empty());
+            ASSERT_EQ(81, moved.at(9));
+
+            dynamic_hash_map<int, int> copy = moved;
+            ASSERT_EQ(64, copy.size());
+        }
+    }
+
+    TEST(HashMapTests, StaticMapRecyclesTombstones)
+    {
+        static_hash_map<uint32_t, uint32_t, 32> map;
+        ASSERT_GE(map.max_load(), 32);
+
+        // Far more inserts than capacity, never more than 32 live at once
+        for(uint32_t round = 0; round < 100; round++)
+        {
+            for(uint32_t i = 0; i < 32; i++)
+                ASSERT_TRUE(map.try_emplace(round * 32 + i, i).second);
+
+            ASSERT_EQ(32, map.size());
+
+            for(uint32_t i = 0; i < 32; i++)
+                ASSERT_EQ(1, map.erase(round * 32 + i));
+        }
+
+        ASSERT_TRUE(map.empty());
+    }
+
+    TEST(HashMapTests, WorksWithNonPolymorphicAllocators)
+    {
+        struct alignas(32) Aligned
+        {
+            int value;
+        };
+
+        dynamic_hash_map<int, Aligned, std::hash<int>, std::equal_to<>, std::allocator<std::byte>>
+            map;
+        for(int i = 0; i < 500; i++)
+            map[i] = Aligned {i};
+
+        for(int i = 0; i < 500; i++)
+        {
+            ASSERT_EQ(i, map.at(i).value);
+            ASSERT_EQ(0, reinterpret_cast<uintptr_t>(&map.at(i)) % alignof(Aligned));
+        }
+    }
+} // namespace container_tests
@@ -0,0 +1,130 @@
+// STD Headers
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <utility>
+
+// Library Headers
+#include <gtest/gtest.h>
+
+import sj.std.containers.vector;
+import sj.std.memory.resources.free_list_allocator;
+
+using namespace sj;
+
+namespace container_tests
+{
+    TEST(SmallVectorTests, StaysInlineUpToCapacity)
+    {
+        std::array<std::byte, 4096> buffer;
+        free_list_allocator resource(buffer.size(), buffer.data());
+
+        small_vector<int, 4> vec(&resource);
+        ASSERT_TRUE(vec.is_inline());
+        ASSERT_EQ(4, vec.capacity());
+
+        for(int i = 0; i < 4; i++)
+            vec.emplace_back(i);
+
+        ASSERT_TRUE(vec.is_inline());
+        ASSERT_FALSE(resource.contains_ptr(vec.data()));
+
+        // Fifth element spills to the resource
+        vec.emplace_back(4);
+        ASSERT_FALSE(vec.is_inline());
+        ASSERT_TRUE(resource.contains_ptr(vec.data()));
+
+        for(int i = 0; i < 5; i++)
+            ASSERT_EQ(i, vec[i]);
+    }
+
+    TEST(SmallVectorTests, MatchesVectorInterface)
+    {
+        small_vector<std::string, 2> vec = {"b", "d"};
+        vec.insert(vec.begin(), "a");
+        vec.emplace(vec.begin() + 2, "c");
+        ASSERT_EQ(4, vec.size());
+
+        const char* expected[] = {"a", "b", "c", "d"};
+        for(size_t i = 0; const std::string& entry : vec)
+            ASSERT_EQ(expected[i++], entry);
+
+        vec.erase(vec.begin() + 1);
+        ASSERT_EQ("c", vec[1]);
+
+        vec.pop_back();
+        ASSERT_EQ("c", vec.back());
+
+        vec.clear();
+        ASSERT_TRUE(vec.empty());
+    }
+
+    TEST(SmallVectorTests, MoveRelocatesInlineElements)
+    {
+        small_vector<std::string, 4> inlineVec = {"Foo", "Bar"};
+        small_vector<std::string, 4> moved(std::move(inlineVec));
+
+        ASSERT_EQ(0, inlineVec.size()); // NOLINT(clang-analyzer-cplusplus.Move)
+        ASSERT_TRUE(moved.is_inline());
+        ASSERT_EQ("Foo", moved[0]);
+        ASSERT_EQ("Bar", moved[1]);
+
+        // Heap buffers are stolen outright
+        small_vector<std::string, 1> heapVec = {"One", "Two", "Three"};
+        const std::string* heapData = heapVec.data();
+
+        small_vector<std::string, 1> stolen;
+        stolen = std::move(heapVec);
+        ASSERT_EQ(heapData, stolen.data());
+        ASSERT_EQ(3, stolen.size());
+        ASSERT_TRUE(heapVec.is_inline()); // NOLINT(clang-analyzer-cplusplus.Move)
+
+        // Moved-from vectors are reusable
+        heapVec.emplace_back("Again");
+        ASSERT_EQ("Again", heapVec[0]);
+    }
+
+    TEST(SmallVectorTests, CopiesAreIndependent)
+    {
+        small_vector<std::string, 2> original = {"Biz", "Baz", "Buzz"};
+        small_vector<std::string, 2> copy(original);
+        ASSERT_NE(original.data(), copy.data());
+
+        copy[0] = "Changed";
+        ASSERT_EQ("Biz", original[0]);
+
+        small_vector<std::string, 2> assigned = {"Foo"};
+        assigned = original;
+        ASSERT_EQ(3, assigned.size());
+        ASSERT_EQ("Buzz", assigned[2]);
+    }
+
+    TEST(SmallVectorTests, ElementsAreDestroyed)
+    {
+        static int destroyed = 0;
+        struct Tracked
+        {
+            Tracked() = default;
+            Tracked(const Tracked&) = default;
+            ~Tracked()
+            {
+                destroyed++;
+            }
+        };
+
+        {
+            small_vector<Tracked, 2> vec;
+            vec.resize(2);
+            destroyed = 0;
+        }
+        ASSERT_EQ(2, destroyed);
+
+        {
+            small_vector<Tracked, 2> vec;
+            vec.resize(5);
+            destroyed = 0;
+        }
+        ASSERT_EQ(5, destroyed);
+    }
+} // namespace container_tests
@@ -0,0 +1,145 @@
+// STD Headers
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <tuple>
+#include <utility>
+
+// Library Headers
+#include <gtest/gtest.h>
+
+import sj.std.containers.soa_vector;
+import sj.std.memory.resources.free_list_allocator;
+
+using namespace sj;
+
+namespace container_tests
+{
+    struct SoaVec3
+    {
+        float x, y, z;
+    };
+
+    TEST(SoaVectorTests, PushBackAndColumns)
+    {
+        soa_vector<SoaVec3, float, uint8_t> vec;
+        ASSERT_TRUE(vec.empty());
+
+        for(int i = 0; i < 100; i++)
+        {
+            const float f = static_cast<float>(i);
+            vec.push_back({SoaVec3 {f, f, f}, f * 2.0f, uint8_t(i)});
+        }
+
+        ASSERT_EQ(100, vec.size());
+
+        auto velocities = vec.column<1>();
+        ASSERT_EQ(100, velocities.size());
+        for(size_t i = 0; i < velocities.size(); i++)
+            ASSERT_EQ(float(i) * 2.0f, velocities[i]);
+
+        // Every column starts on the SIMD friendly boundary
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(vec.column<0>().data()) % 64);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(vec.column<1>().data()) % 64);
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(vec.column<2>().data()) % 64);
+
+        auto [position, speed, flags] = vec[42];
+        ASSERT_EQ(42.0f, position.y);
+        ASSERT_EQ(84.0f, speed);
+        ASSERT_EQ(42, flags);
+    }
+
+    TEST(SoaVectorTests, IteratorsYieldReferences)
+    {
+        soa_vector<int, std::string> vec;
+        vec.emplace_back(1, "one");
+        vec.emplace_back(2, "two");
+        vec.emplace_back(3, "three");
+
+        for(auto [number, name] : vec)
+        {
+            number *= 10;
+            name += "!";
+        }
+
+        const soa_vector<int, std::string>& constVec = vec;
+        int expected = 10;
+        for(auto it = constVec.begin(); it != constVec.end(); ++it)
+        {
+            ASSERT_EQ(expected, std::get<0>(*it));
+            ASSERT_EQ('!', std::get<1>(*it).back());
+            expected += 10;
+        }
+
+        ASSERT_EQ(3, vec.end() - vec.begin());
+    }
+
+    TEST(SoaVectorTests, EraseUnorderedKeepsRowsTogether)
+    {
+        soa_vector<int, std::string> vec;
+        for(int i = 0; i < 5; i++)
+            vec.emplace_back(i, std::to_string(i));
+
+        vec.erase_unordered(1);
+        ASSERT_EQ(4, vec.size());
+        ASSERT_EQ(4, std::get<0>(vec[1]));
+        ASSERT_EQ("4", std::get<1>(vec[1]));
+
+        vec.erase_unordered(vec.begin() + 3);
+        ASSERT_EQ(3, vec.size());
+
+        for(const auto& [number, name] : vec)
+            ASSERT_EQ(std::to_string(number), name);
+
+        vec.pop_back();
+        vec.clear();
+        ASSERT_TRUE(vec.empty());
+    }
+
+    TEST(SoaVectorTests, UsesProvidedResource)
+    {
+        std::array<std::byte, 8192> buffer;
+        free_list_allocator resource(buffer.size(), buffer.data());
+
+        {
+            soa_vector<double, std::string> vec(16, &resource);
+            ASSERT_EQ(16, vec.capacity());
+
+            for(int i = 0; i < 40; i++)
+                vec.emplace_back(i * 0.5, "a fairly long string that will not fit inline");
+
+            ASSERT_TRUE(resource.contains_ptr(vec.column<0>().data()));
+            ASSERT_EQ("a fairly long string that will not fit inline", std::get<1>(vec.back()));
+
+            soa_vector<double, std::string> moved = std::move(vec);
+            ASSERT_TRUE(vec.empty()); // NOLINT(clang-analyzer-cplusplus.Move)
+            ASSERT_EQ(40, moved.size());
+            ASSERT_EQ(19.5, std::get<0>(moved.back()));
+        }
+    }
+
+    TEST(SoaVectorTests, MoveAssignAcrossAllocators)
+    {
+        std::array<std::byte, 8192> buffer;
+        free_list_allocator resource(buffer.size(), buffer.data());
+
+        {
+            soa_vector<double, std::string> source(&resource);
+            for(int i = 0; i < 20; i++)
+                source.emplace_back(i * 0.5, "a fairly long string that will not fit inline");
+
+            soa_vector<double, std::string> destination;
+            destination.emplace_back(1.0, "replaced");
+
+            destination = std::move(source);
+            ASSERT_TRUE(source.empty()); // NOLINT(clang-analyzer-cplusplus.Move)
+            ASSERT_EQ(20, destination.size());
+            ASSERT_FALSE(resource.contains_ptr(destination.column<0>().data()));
+            ASSERT_EQ(9.5, std::get<0>(destination.back()));
+            ASSERT_EQ("a fairly long string that will not fit inline",
+                      std::get<1>(destination.back()));
+        }
+    }
+} // namespace container_tests
@@ -0,0 +1,56 @@
+// STD Headers
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+// Library Headers
+#include <gtest/gtest.h>
+
+import sj.std.containers.type_list;
+
+using namespace sj;
+
+namespace container_tests
+{
+    template <size_t I>
+    struct TypeMapTag
+    {
+        // Spread like type ids, which are string hashes
+        static constexpr uint32_t kKey = static_cast<uint32_t>(I * 2654435761u) ^ 0x5bd1e995u;
+    };
+
+    constexpr auto kManyTypes = []<size_t... Is>(std::index_sequence<Is...>) {
+        return type_list<TypeMapTag<Is>...> {};
+    }(std::make_index_sequence<300>());
+
+    constexpr auto kKeyOf = []<class T>() -> uint32_t { return T::kKey; };
+    constexpr auto kValueOf = []<class T>() -> uint32_t { return T::kKey % 1000; };
+
+    TEST(TypeMapTests, FindsEveryKeyOfLargeList)
+    {
+        constinit static type_map<kManyTypes, uint32_t, uint32_t, kKeyOf, kValueOf> map = {};
+
+        kManyTypes.for_each<[]<class T>() {
+            const uint32_t* value = map.find(T::kKey);
+            ASSERT_NE(nullptr, value);
+            ASSERT_EQ(T::kKey % 1000, *value);
+            ASSERT_EQ(*value, map.get(T::kKey));
+        }>();
+    }
+
+    TEST(TypeMapTests, MissingKeysReturnNull)
+    {
+        constexpr type_map<type_list<TypeMapTag<1>, TypeMapTag<2>> {},
+                           uint32_t,
+                           uint32_t,
+                           kKeyOf,
+                           kValueOf>
+            map {};
+
+        static_assert(map.find(TypeMapTag<3>::kKey) == nullptr);
+        static_assert(map.get(TypeMapTag<2>::kKey) == TypeMapTag<2>::kKey % 1000);
+
+        constexpr type_map<type_list<> {}, uint32_t, uint32_t, kKeyOf, kValueOf> empty {};
+        ASSERT_EQ(nullptr, empty.find(0));
+    }
+} // namespace container_tests
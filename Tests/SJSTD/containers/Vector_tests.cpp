@@ -1,5 +1,8 @@
 // STD Headers
+#include <array>
+#include <cstddef>
 #include <span>
+#include <string>
 
 // Library Headers
 #include "gtest/gtest.h"
@@ -8,6 +11,8 @@
 #include <ScrewjankStd/Log.hpp>
 
 import sj.std.containers.vector;
+import sj.std.memory.resources.free_list_allocator;
+import sj.std.type_traits;
 
 using namespace sj;
 
@@ -483,4 +488,44 @@ namespace container_tests
         }
     }
 
+    TEST(VectorTests, ReserveRelocatesOnlyLiveElements)
+    {
+        static_assert(is_trivially_relocatable_v<int>);
+        static_assert(!is_trivially_relocatable_v<std::string>);
+
+        dynamic_vector<std::string> vec;
+        vec.reserve(8);
+        vec.emplace_back("first");
+        vec.emplace_back("second");
+
+        // Only the two constructed strings may be touched when the buffer moves
+        vec.reserve(64);
+        ASSERT_EQ(2, vec.size());
+        ASSERT_EQ("first", vec[0]);
+        ASSERT_EQ("second", vec[1]);
+
+        vec.erase(vec.begin());
+        ASSERT_EQ(1, vec.size());
+        ASSERT_EQ("second", vec[0]);
+    }
+
+    TEST(VectorTests, GrowsInPlaceWhenResourceAllows)
+    {
+        std::array<std::byte, 4096> buffer;
+        free_list_allocator resource(buffer.size(), buffer.data());
+
+        dynamic_vector<int> vec(&resource);
+        vec.reserve(16);
+        for(int i = 0; i < 16; i++)
+            vec.emplace_back(i);
+
+        // Nothing follows the vector's buffer, so it can extend into the free space after it
+        const int* original = vec.data();
+        vec.reserve(256);
+        ASSERT_EQ(original, vec.data());
+
+        for(int i = 0; i < 16; i++)
+            ASSERT_EQ(i, vec[i]);
+    }
+
 } // namespace container_tests
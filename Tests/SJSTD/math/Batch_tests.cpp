@@ -0,0 +1,151 @@
+// STD Headers
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Library Headers
+#include "gtest/gtest.h"
+
+import sj.std.math;
+
+using namespace sj;
+
+namespace math_tests
+{
+    const Mat44 kTransform =
+        BuildTransform(Vec4(1, 2, 3, 0), Vec3 {0.3f, -1.1f, 2.0f}, Vec4(7, 8, 9, 1));
+
+    // Covers empty input, a partial batch, whole batches and a tail
+    constexpr size_t kCounts[] = {0, 1, 7, 8, 9, 16, 37};
+
+    void ExpectNear(const Vec3& expected, const Vec3& actual)
+    {
+        EXPECT_NEAR(expected.x, actual.x, 1e-4f);
+        EXPECT_NEAR(expected.y, actual.y, 1e-4f);
+        EXPECT_NEAR(expected.z, actual.z, 1e-4f);
+    }
+
+    std::vector<Vec3> RandomPoints(size_t count, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+
+        std::vector<Vec3> points(count);
+        for(Vec3& p : points)
+            p = {dist(rng), dist(rng), dist(rng)};
+
+        return points;
+    }
+
+    TEST(BatchTests, TransformPointsMatchesSingle)
+    {
+        std::mt19937 rng(1);
+
+        for(size_t count : kCounts)
+        {
+            const std::vector<Vec3> points = RandomPoints(count, rng);
+            std::vector<Vec3> out(count);
+
+            TransformPoints(points, kTransform, out);
+
+            for(size_t i = 0; i < count; i++)
+            {
+                const Vec4 expected = Vec4(points[i], 1.0f) * kTransform;
+                ExpectNear({expected.GetX(), expected.GetY(), expected.GetZ()}, out[i]);
+            }
+        }
+    }
+
+    TEST(BatchTests, TransformAABBsMatchesSingle)
+    {
+        std::mt19937 rng(2);
+
+        for(size_t count : kCounts)
+        {
+            const std::vector<Vec3> corners = RandomPoints(count * 2, rng);
+
+            std::vector<AABB> boxes(count);
+            for(size_t i = 0; i < count; i++)
+            {
+                const Vec3& a = corners[i * 2];
+                const Vec3& b = corners[i * 2 + 1];
+                boxes[i] = AABB::Merge({a, a}, {b, b});
+            }
+
+            std::vector<AABB> out(count);
+            TransformAABBs(boxes, kTransform, out);
+
+            for(size_t i = 0; i < count; i++)
+            {
+                const AABB expected = TransformAABB(boxes[i], kTransform);
+                ExpectNear(expected.min, out[i].min);
+                ExpectNear(expected.max, out[i].max);
+            }
+
+            // In place must give the same answer
+            TransformAABBs(boxes, kTransform, boxes);
+
+            for(size_t i = 0; i < count; i++)
+            {
+                ExpectNear(out[i].min, boxes[i].min);
+                ExpectNear(out[i].max, boxes[i].max);
+            }
+        }
+    }
+
+    TEST(BatchTests, TransformAABBEnclosesCorners)
+    {
+        const AABB box = {.min = {-1, -2, -3}, .max = {4, 5, 6}};
+        AABB transformed = TransformAABB(box, kTransform);
+
+        // Allow for rounding on the faces the corners touch
+        transformed.min = {transformed.min.x - 1e-3f,
+                           transformed.min.y - 1e-3f,
+                           transformed.min.z - 1e-3f};
+        transformed.max = {transformed.max.x + 1e-3f,
+                           transformed.max.y + 1e-3f,
+                           transformed.max.z + 1e-3f};
+
+        for(int corner = 0; corner < 8; corner++)
+        {
+            const Vec4 p((corner & 1) ? box.max.x : box.min.x,
+                         (corner & 2) ? box.max.y : box.min.y,
+                         (corner & 4) ? box.max.z : box.min.z,
+                         1.0f);
+            const Vec4 moved = p * kTransform;
+
+            EXPECT_TRUE(transformed.Contains(Vec3 {moved.GetX(), moved.GetY(), moved.GetZ()}));
+        }
+    }
+
+    TEST(BatchTests, MultiplyMatrices)
+    {
+        const std::vector<Mat44> lhs = {Mat44(kIdentityTag),
+                                        kTransform,
+                                        Mat44::FromEulerXYZ(Vec3 {1.0f, 0.5f, -0.25f})};
+        const std::vector<Mat44> rhs = {kTransform, kTransform.AffineInverse(), kTransform};
+
+        std::vector<Mat44> out(lhs.size());
+        MultiplyMatrices(lhs, rhs, out);
+
+        std::vector<Mat44> shared(lhs.size());
+        MultiplyMatrices(lhs, kTransform, shared);
+
+        for(size_t i = 0; i < lhs.size(); i++)
+        {
+            const Mat44 expected = lhs[i] * rhs[i];
+            const Mat44 expectedShared = lhs[i] * kTransform;
+
+            for(int row = 0; row < 4; row++)
+            {
+                for(int col = 0; col < 4; col++)
+                {
+                    EXPECT_FLOAT_EQ(expected.Data()[row].Data()[col],
+                                    out[i].Data()[row].Data()[col]);
+                    EXPECT_FLOAT_EQ(expectedShared.Data()[row].Data()[col],
+                                    shared[i].Data()[row].Data()[col]);
+                }
+            }
+        }
+    }
+
+} // namespace math_tests
@@ -0,0 +1,96 @@
+// STD Headers
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Library Headers
+#include "gtest/gtest.h"
+
+import sj.std.math;
+
+using namespace sj;
+
+namespace math_tests
+{
+    // Reversed Z perspective matching the renderer's
+    Mat44 Projection()
+    {
+        constexpr float near = 10000.0f;
+        constexpr float far = 0.1f;
+        const float invTanHalfFov = 1.0f / std::tan(ToRadians(45.0f) / 2.0f);
+
+        Mat44 res;
+        res.Set<0, 0>(invTanHalfFov / 1.5f);
+        res.Set<1, 1>(invTanHalfFov);
+        res.Set<2, 2>(far / (near - far));
+        res.Set<2, 3>(-1.0f);
+        res.Set<3, 2>((near * far) / (near - far));
+        return res;
+    }
+
+    const Transform kCamera = Transform::FromEulerXYZ({1, 2, 3}, {0.2f, 0.5f, 0.1f});
+    const Frustum kFrustum =
+        Frustum::FromViewProjection(kCamera.Inverse().ToMat44() * Projection());
+
+    /** Small box at a camera space position */
+    AABB BoxInCameraSpace(const Vec3& position)
+    {
+        const Vec3 center = kCamera.TransformPoint(position);
+        return {.min = {center.x - 0.01f, center.y - 0.01f, center.z - 0.01f},
+                .max = {center.x + 0.01f, center.y + 0.01f, center.z + 0.01f}};
+    }
+
+    TEST(FrustumTests, IntersectsClassifiesAgainstEachPlane)
+    {
+        // The camera looks down -z
+        ASSERT_TRUE(kFrustum.Intersects(BoxInCameraSpace({0, 0, -10})));
+
+        ASSERT_FALSE(kFrustum.Intersects(BoxInCameraSpace({0, 0, 10})));
+        ASSERT_FALSE(kFrustum.Intersects(BoxInCameraSpace({0, 0, -0.05f})));
+        ASSERT_FALSE(kFrustum.Intersects(BoxInCameraSpace({0, 0, -20000})));
+        ASSERT_FALSE(kFrustum.Intersects(BoxInCameraSpace({-100, 0, -10})));
+        ASSERT_FALSE(kFrustum.Intersects(BoxInCameraSpace({100, 0, -10})));
+        ASSERT_FALSE(kFrustum.Intersects(BoxInCameraSpace({0, -100, -10})));
+        ASSERT_FALSE(kFrustum.Intersects(BoxInCameraSpace({0, 100, -10})));
+    }
+
+    TEST(FrustumTests, BoxStraddlingAPlaneIsVisible)
+    {
+        const AABB huge = {.min = {-1000, -1000, -1000}, .max = {1000, 1000, 1000}};
+        ASSERT_TRUE(kFrustum.Intersects(huge));
+    }
+
+    TEST(FrustumTests, CullAABBsMatchesSingle)
+    {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> position(-200.0f, 200.0f);
+        std::uniform_real_distribution<float> size(0.0f, 5.0f);
+
+        // Covers empty input, a partial batch, whole batches and a tail
+        for(size_t count : {0, 1, 7, 8, 9, 16, 37, 1000})
+        {
+            std::vector<AABB> boxes(count);
+            for(AABB& box : boxes)
+            {
+                const Vec3 center = {position(rng), position(rng), position(rng)};
+                const Vec3 extents = {size(rng), size(rng), size(rng)};
+                box = {.min = {center.x - extents.x, center.y - extents.y, center.z - extents.z},
+                       .max = {center.x + extents.x, center.y + extents.y, center.z + extents.z}};
+            }
+
+            std::vector<uint32_t> expected;
+            for(uint32_t i = 0; i < count; i++)
+            {
+                if(kFrustum.Intersects(boxes[i]))
+                    expected.push_back(i);
+            }
+
+            std::vector<uint32_t> visible(count);
+            const size_t numVisible = CullAABBs(kFrustum, boxes, visible);
+            visible.resize(numVisible);
+
+            ASSERT_EQ(expected, visible);
+        }
+    }
+} // namespace math_tests
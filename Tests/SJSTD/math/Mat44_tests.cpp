@@ -0,0 +1,63 @@
+// STD Headers
+
+// Library Headers
+#include "gtest/gtest.h"
+
+import sj.std.math;
+
+using namespace sj;
+
+namespace math_tests
+{
+    void ExpectNear(const Mat44& expected, const Mat44& actual)
+    {
+        for(int row = 0; row < 4; row++)
+        {
+            for(int col = 0; col < 4; col++)
+            {
+                EXPECT_NEAR(expected.Data()[row].Data()[col], actual.Data()[row].Data()[col], 1e-4f)
+                    << "row " << row << " col " << col;
+            }
+        }
+    }
+
+    constexpr Mat44 kA {{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 16}};
+    constexpr Mat44 kB {{2, 0, 1, 0}, {0, 3, 0, 1}, {1, 0, 1, 0}, {4, 5, 6, 1}};
+
+    // Evaluated by the scalar constexpr path
+    constexpr Mat44 kAB = kA * kB;
+    constexpr Vec4 kVA = Vec4(1, -2, 3, 1) * kA;
+
+    TEST(Mat44Tests, MultiplyMatchesConstexprPath)
+    {
+        // Runtime copies take the SIMD path when one is enabled
+        Mat44 a = kA;
+        Mat44 b = kB;
+        Vec4 v(1, -2, 3, 1);
+
+        ExpectNear(kAB, a * b);
+
+        const Vec4 va = v * a;
+        for(int i = 0; i < 4; i++)
+            EXPECT_FLOAT_EQ(kVA.Data()[i], va.Data()[i]);
+    }
+
+    TEST(Mat44Tests, AffineInverseWithNonUniformScale)
+    {
+        const Mat44 transform =
+            BuildTransform(Vec4(1, 2, 3, 0), Vec3 {0.3f, -1.1f, 2.0f}, Vec4(7, 8, 9, 1));
+
+        ExpectNear(Mat44(kIdentityTag), transform * transform.AffineInverse());
+        ExpectNear(Mat44(kIdentityTag), transform.AffineInverse() * transform);
+    }
+
+    TEST(Mat44Tests, AffineInverseMatchesConstexprPath)
+    {
+        constexpr Mat44 kTransform {{2, 0, 0, 0}, {0, 0, 3, 0}, {0, -0.5f, 0, 0}, {4, 5, 6, 1}};
+        constexpr Mat44 kInverse = kTransform.AffineInverse();
+
+        Mat44 transform = kTransform;
+        ExpectNear(kInverse, transform.AffineInverse());
+    }
+
+} // namespace math_tests
@@ -0,0 +1,70 @@
+// STD Headers
+#include <cmath>
+
+// Library Headers
+#include "gtest/gtest.h"
+
+import sj.std.math;
+
+using namespace sj;
+
+namespace math_tests
+{
+    void ExpectNear(const Quat& expected, const Quat& actual)
+    {
+        for(int i = 0; i < 4; i++)
+            EXPECT_NEAR(expected[i], actual[i], 1e-5f) << "component " << i;
+    }
+
+    Quat AxisAngle(const Vec4& axis, float angle)
+    {
+        Vec4 v = axis * std::sin(angle / 2.0f);
+        v.SetW(std::cos(angle / 2.0f));
+        return Quat(v);
+    }
+
+    TEST(QuatTests, MultiplyMatchesConstexprPath)
+    {
+        constexpr Quat kA(0.1f, 0.2f, 0.3f, 0.9f);
+        constexpr Quat kB(-0.4f, 0.5f, 0.1f, 0.7f);
+        constexpr Quat kAB = kA * kB;
+
+        Quat a = kA;
+        Quat b = kB;
+        ExpectNear(kAB, a * b);
+    }
+
+    TEST(QuatTests, MultiplyComposesRotations)
+    {
+        const Quat quarterTurn = AxisAngle(Vec4_UnitZ, 0.5f);
+        const Quat halfTurn = AxisAngle(Vec4_UnitZ, 1.0f);
+
+        ExpectNear(halfTurn, quarterTurn * quarterTurn);
+        ExpectNear(Quat(kIdentityTag), quarterTurn * quarterTurn.Conjugate());
+    }
+
+    TEST(QuatTests, Slerp)
+    {
+        const Quat from(kIdentityTag);
+        const Quat to = AxisAngle(Vec4_UnitY, 1.0f);
+
+        ExpectNear(from, Slerp(from, to, 0.0f));
+        ExpectNear(to, Slerp(from, to, 1.0f));
+        ExpectNear(AxisAngle(Vec4_UnitY, 0.25f), Slerp(from, to, 0.25f));
+
+        // -to is the same rotation and must take the same short path
+        const Quat negated(-to[0], -to[1], -to[2], -to[3]);
+        ExpectNear(AxisAngle(Vec4_UnitY, 0.5f), Slerp(from, negated, 0.5f));
+    }
+
+    TEST(QuatTests, SlerpNearlyParallel)
+    {
+        const Quat from = AxisAngle(Vec4_UnitX, 0.3f);
+        const Quat to = AxisAngle(Vec4_UnitX, 0.3001f);
+
+        const Quat mid = Slerp(from, to, 0.5f);
+        EXPECT_NEAR(1.0f, mid.Dot(mid), 1e-5f);
+        ExpectNear(AxisAngle(Vec4_UnitX, 0.30005f), mid);
+    }
+
+} // namespace math_tests
@@ -0,0 +1,70 @@
+// STD Headers
+
+// Library Headers
+#include "gtest/gtest.h"
+
+import sj.std.math;
+
+using namespace sj;
+
+namespace math_tests
+{
+    void ExpectNear(const Mat44& expected, const Mat44& actual)
+    {
+        for(int row = 0; row < 4; row++)
+        {
+            for(int col = 0; col < 4; col++)
+            {
+                EXPECT_NEAR(expected.Data()[row].Data()[col], actual.Data()[row].Data()[col], 1e-4f)
+                    << "row " << row << " col " << col;
+            }
+        }
+    }
+
+    const Transform kA = Transform::FromEulerXYZ({1, -2, 3}, {1.0f, 0.2f, -0.4f}, {2, 2, 2});
+    const Transform kB = Transform::FromEulerXYZ({-3, 0.5f, 4}, {-0.5f, 0.9f, 0.1f});
+
+    TEST(TransformTests, ToMat44MatchesBuildTransform)
+    {
+        const Vec3 eulers = {0.3f, -1.1f, 2.0f};
+        const Transform transform = Transform::FromEulerXYZ({7, 8, 9}, eulers, {1, 2, 3});
+
+        ExpectNear(BuildTransform(Vec4(1, 2, 3, 0), eulers, Vec4(7, 8, 9, 1)),
+                   transform.ToMat44());
+    }
+
+    TEST(TransformTests, ComposeMatchesMatrixMultiply)
+    {
+        ExpectNear(kA.ToMat44() * kB.ToMat44(), (kA * kB).ToMat44());
+        ExpectNear(kB.ToMat44() * kA.ToMat44(), (kB * kA).ToMat44());
+    }
+
+    TEST(TransformTests, InverseMatchesAffineInverse)
+    {
+        ExpectNear(kA.ToMat44().AffineInverse(), kA.Inverse().ToMat44());
+        ExpectNear(Mat44(kIdentityTag), (kA * kA.Inverse()).ToMat44());
+    }
+
+    TEST(TransformTests, TransformPointMatchesMatrix)
+    {
+        const Vec3 point = {1, 2, 3};
+        const Vec3 moved = kA.TransformPoint(point);
+        const Vec4 expected = Vec4(point, 1.0f) * kA.ToMat44();
+
+        EXPECT_NEAR(expected.GetX(), moved.x, 1e-4f);
+        EXPECT_NEAR(expected.GetY(), moved.y, 1e-4f);
+        EXPECT_NEAR(expected.GetZ(), moved.z, 1e-4f);
+    }
+
+    TEST(TransformTests, Interpolate)
+    {
+        ExpectNear(kA.ToMat44(), Interpolate(kA, kB, 0.0f).ToMat44());
+        ExpectNear(kB.ToMat44(), Interpolate(kA, kB, 1.0f).ToMat44());
+
+        const Transform mid = Interpolate(kA, kB, 0.5f);
+        EXPECT_NEAR(-1.0f, mid.translation.x, 1e-5f);
+        EXPECT_NEAR(1.5f, mid.scale.x, 1e-5f);
+        EXPECT_NEAR(1.0f, mid.rotation.Dot(mid.rotation), 1e-5f);
+    }
+
+} // namespace math_tests
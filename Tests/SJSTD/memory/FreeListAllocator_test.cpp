@@ -3,7 +3,11 @@
 #include "gtest/gtest.h"
 
 // STD Headers
+#include <cstdint>
+#include <cstring>
 #include <memory_resource>
+#include <thread>
+#include <vector>
 
 import sj.std.memory.resources.free_list_allocator;
 import sj.std.memory.utils;
@@ -149,4 +153,83 @@ namespace system_tests {
 
         heap->deallocate(test_memory, alloc_size);
     }
+
+    TEST(FreeListAllocatorTests, TryExpandIntoAdjacentFreeBlock)
+    {
+        std::pmr::memory_resource* heap = std::pmr::get_default_resource();
+        size_t alloc_size = 1024;
+        void* test_memory = heap->allocate(alloc_size);
+
+        free_list_allocator resource;
+        resource.init(alloc_size, reinterpret_cast<std::byte*>(test_memory));
+
+        void* first = resource.allocate(64);
+        void* second = resource.allocate(64);
+
+        // Blocked by the second allocation
+        ASSERT_FALSE(resource.try_expand(first, 64, 256));
+
+        // The second allocation is followed by the rest of the buffer
+        ASSERT_TRUE(resource.try_expand(second, 64, 256));
+        std::memset(second, 0xAB, 256);
+
+        // The remainder is still usable, and starts after the expanded allocation
+        void* third = resource.allocate(64);
+        ASSERT_NE(nullptr, third);
+        ASSERT_GE(uintptr_t(third), uintptr_t(second) + 256);
+
+        // Freeing the second allocation lets the first grow into its space
+        resource.deallocate(second, 256);
+        ASSERT_TRUE(resource.try_expand(first, 64, 128));
+
+        resource.deallocate(first, 128);
+        resource.deallocate(third, 64);
+
+        heap->deallocate(test_memory, alloc_size);
+    }
+
+    TEST(FreeListAllocatorTests, ConcurrentAllocateAndFree)
+    {
+        constexpr size_t kNumThreads = 4;
+        constexpr size_t kIterations = 2000;
+
+        std::pmr::memory_resource* heap = std::pmr::get_default_resource();
+        size_t alloc_size = 64 * 1024;
+        void* test_memory = heap->allocate(alloc_size);
+
+        free_list_allocator resource;
+        resource.init(alloc_size, reinterpret_cast<std::byte*>(test_memory));
+
+        // Each thread frees memory another thread allocated, like global delete on a worker
+        void* handoff[kNumThreads] = {};
+        for(void*& memory : handoff)
+            memory = resource.allocate(32);
+
+        std::vector<std::thread> threads;
+        for(size_t t = 0; t < kNumThreads; t++)
+        {
+            threads.emplace_back([&resource, &handoff, t]() {
+                resource.deallocate(handoff[(t + 1) % kNumThreads], 32);
+
+                for(size_t i = 0; i < kIterations; i++)
+                {
+                    const size_t size = 16 + (i + t) % 8 * 16;
+                    auto* memory = static_cast<unsigned char*>(resource.allocate(size));
+                    std::memset(memory, int(t), size);
+                    ASSERT_EQ(int(t), memory[size - 1]);
+                    resource.deallocate(memory, size);
+                }
+            });
+        }
+
+        for(std::thread& thread : threads)
+            thread.join();
+
+        // Everything coalesced back into one block
+        void* everything = resource.allocate(alloc_size / 2);
+        ASSERT_NE(nullptr, everything);
+        resource.deallocate(everything, alloc_size / 2);
+
+        heap->deallocate(test_memory, alloc_size);
+    }
 } // namespace system_tests
@@ -6,6 +6,7 @@
 // Void Engine Headers
 #include <ScrewjankStd/PlatformDetection.hpp>
 #include <memory_resource>
+#include <vector>
 
 import sj.std.memory.resources.linear_allocator;
 import sj.std.memory.scratchpad_scope;
@@ -119,4 +120,81 @@ namespace system_tests
         size_t new_watermark = test_resource.get_current_offset();
         ASSERT_EQ(watermark, new_watermark);
     }
+
+    TEST(LinearAllocatorTests, OverflowChainTest)
+    {
+        std::pmr::memory_resource* mem_resource = std::pmr::get_default_resource();
+        size_t mem_size = 64;
+        void* memory = mem_resource->allocate(mem_size);
+
+        linear_allocator test_resource(mem_size, reinterpret_cast<std::byte*>(memory));
+        test_resource.set_overflow_resource(mem_resource);
+
+        void* in_buffer = test_resource.allocate(48, alignof(std::byte));
+        ASSERT_NE(nullptr, in_buffer);
+        ASSERT_EQ(0, test_resource.get_overflow_block_count());
+
+        // Doesn't fit in the remaining 16 bytes, so a block is chained
+        auto* overflow = static_cast<std::byte*>(test_resource.allocate(32, alignof(std::byte)));
+        ASSERT_NE(nullptr, overflow);
+        ASSERT_EQ(1, test_resource.get_overflow_block_count());
+        ASSERT_TRUE(test_resource.contains_ptr(overflow));
+        ASSERT_EQ(80, test_resource.bytes_in_use());
+
+        // Larger than the minimum block size
+        auto* large = static_cast<std::byte*>(test_resource.allocate(1024, alignof(std::byte)));
+        ASSERT_NE(nullptr, large);
+        ASSERT_EQ(2, test_resource.get_overflow_block_count());
+        large[0] = std::byte {1};
+        large[1023] = std::byte {2};
+
+        ASSERT_EQ(1104, test_resource.get_high_water_mark());
+
+        test_resource.reset();
+        ASSERT_EQ(0, test_resource.get_overflow_block_count());
+        ASSERT_EQ(0, test_resource.bytes_in_use());
+        ASSERT_EQ(1104, test_resource.get_high_water_mark());
+
+        mem_resource->deallocate(memory, mem_size);
+    }
+
+    TEST(LinearAllocatorTests, ScratchpadScopeReleasesOverflowTest)
+    {
+        std::pmr::memory_resource* mem_resource = std::pmr::get_default_resource();
+        size_t mem_size = 128;
+        void* memory = mem_resource->allocate(mem_size);
+
+        linear_allocator test_resource(mem_size, reinterpret_cast<std::byte*>(memory));
+        test_resource.set_overflow_resource(mem_resource);
+
+        [[maybe_unused]] void* outer = test_resource.allocate(64, alignof(std::byte));
+        size_t outer_offset = test_resource.get_current_offset();
+
+        {
+            scratchpad_scope scratchpad(test_resource);
+
+            // Grow a vector well past the buffer size
+            std::pmr::vector<int> values(&scratchpad.get_allocator());
+            for(int i = 0; i < 1000; i++)
+                values.push_back(i);
+
+            ASSERT_EQ(999, values.back());
+            ASSERT_LT(0, test_resource.get_overflow_block_count());
+
+            {
+                scratchpad_scope inner(test_resource);
+                size_t blocks_before = test_resource.get_overflow_block_count();
+                [[maybe_unused]] auto _ = inner.get_allocator().allocate(4096, alignof(int));
+                ASSERT_EQ(blocks_before + 1, test_resource.get_overflow_block_count());
+            }
+
+            ASSERT_EQ(999, values.back());
+        }
+
+        ASSERT_EQ(0, test_resource.get_overflow_block_count());
+        ASSERT_EQ(outer_offset, test_resource.get_current_offset());
+        ASSERT_LT(4096, test_resource.get_high_water_mark());
+
+        mem_resource->deallocate(memory, mem_size);
+    }
 } // namespace system_tests
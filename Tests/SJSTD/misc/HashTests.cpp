@@ -0,0 +1,102 @@
+// STD Headers
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+// Library Headers
+#include "gtest/gtest.h"
+
+// Engine Headers
+
+import sj.std.hash;
+import sj.std.string_hash;
+
+using namespace sj;
+
+namespace string_tests
+{
+
+    TEST(HashTests, WyHashIsConstexpr)
+    {
+        constexpr uint64_t kCompileTime = WyHash64("Assets/Textures/Ground.ktx2");
+        const std::string runtime = "Assets/Textures/Ground.ktx2";
+
+        ASSERT_EQ(kCompileTime, WyHash64(runtime));
+        ASSERT_EQ(kCompileTime, WyHash64(std::as_bytes(std::span(runtime))));
+        static_assert("MoveForward"_strhash64 == string_hash64("MoveForward"));
+    }
+
+    TEST(HashTests, WyHashMatchesReferenceVectors)
+    {
+        // Test vectors shipped with the reference wyhash final version 4.2, seeded with their index
+        struct TestVector
+        {
+            std::string_view input;
+            uint64_t expected;
+        };
+
+        constexpr TestVector kVectors[] = {
+            {"", 0x93228a4de0eec5a2ull},
+            {"a", 0xc5bac3db178713c4ull},
+            {"abc", 0xa97f2f7b1d9b3314ull},
+            {"message digest", 0x786d1f1df3801df4ull},
+            {"abcdefghijklmnopqrstuvwxyz", 0xdca5a8138ad37c87ull},
+            {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+             0xb9e734f117cfaf70ull},
+            {"12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+             0x6cc5eab49a92d617ull}};
+
+        for(uint64_t seed = 0; seed < std::size(kVectors); seed++)
+        {
+            const std::string runtime(kVectors[seed].input);
+            ASSERT_EQ(kVectors[seed].expected, WyHash64(runtime, seed)) << runtime;
+        }
+
+        static_assert(WyHash64("message digest", 3) == 0x786d1f1df3801df4ull);
+    }
+
+    TEST(HashTests, WyHashCoversEveryLengthPath)
+    {
+        // Lengths 0-3, 4-16, 17-47 and 48+ each take a different path
+        std::string text;
+        std::unordered_set<uint64_t> seen;
+        for(size_t length = 0; length <= 200; length++)
+        {
+            ASSERT_TRUE(seen.insert(WyHash64(text)).second) << "Collision at length " << length;
+            text.push_back(static_cast<char>('a' + length % 26));
+        }
+
+        // Every byte contributes, including the ones only read by overlapping loads
+        const std::string base(64, 'x');
+        for(size_t i = 0; i < base.size(); i++)
+        {
+            std::string changed = base;
+            changed[i] = 'y';
+            ASSERT_NE(WyHash64(base), WyHash64(changed)) << "Byte " << i << " was ignored";
+        }
+    }
+
+    TEST(HashTests, WyHashSeedChangesResult)
+    {
+        ASSERT_NE(WyHash64("seeded", 0), WyHash64("seeded", 1));
+        ASSERT_EQ(WyHash64("seeded", 7), WyHash64("seeded", 7));
+    }
+
+    TEST(HashTests, StringHash64HasNoCollisionsOnAssetLikeNames)
+    {
+        std::unordered_set<string_hash64> hashes;
+        for(int dir = 0; dir < 100; dir++)
+        {
+            for(int file = 0; file < 1000; file++)
+            {
+                const std::string path =
+                    "Assets/Dir" + std::to_string(dir) + "/Mesh" + std::to_string(file) + ".mesh";
+                ASSERT_TRUE(hashes.insert(string_hash64(path)).second) << path;
+            }
+        }
+    }
+
+} // namespace string_tests
@@ -0,0 +1,89 @@
+// STD Headers
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+
+// Library Headers
+#include "gtest/gtest.h"
+
+// Engine Headers
+
+import sj.std.inplace_function;
+
+using namespace sj;
+
+namespace misc_tests
+{
+
+    int AddOne(int value)
+    {
+        return value + 1;
+    }
+
+    TEST(InplaceFunctionTests, CallsTargets)
+    {
+        inplace_function<int(int)> fn;
+        ASSERT_FALSE(fn);
+        ASSERT_TRUE(fn == nullptr);
+
+        fn = AddOne;
+        ASSERT_EQ(2, fn(1));
+
+        int offset = 10;
+        fn = [offset](int value) { return value + offset; };
+        ASSERT_EQ(11, fn(1));
+
+        fn = nullptr;
+        ASSERT_FALSE(fn);
+    }
+
+    TEST(InplaceFunctionTests, CopyAndMoveKeepState)
+    {
+        auto counter = std::make_shared<int>(0);
+
+        inplace_function<void()> original = [counter]() { (*counter)++; };
+        inplace_function<void()> copy = original;
+        ASSERT_EQ(3, counter.use_count());
+
+        original();
+        copy();
+        ASSERT_EQ(2, *counter);
+
+        inplace_function<void()> moved = std::move(original);
+        ASSERT_FALSE(original); // NOLINT(clang-analyzer-cplusplus.Move)
+        ASSERT_EQ(3, counter.use_count());
+
+        moved();
+        ASSERT_EQ(3, *counter);
+
+        copy.reset();
+        moved = nullptr;
+        ASSERT_EQ(1, counter.use_count());
+    }
+
+    TEST(InplaceFunctionTests, CustomCapacity)
+    {
+        std::array<int, 16> big = {};
+        big[15] = 7;
+
+        inplace_function<int(), sizeof(big)> fn = [big]() { return big[15]; };
+        ASSERT_EQ(7, fn());
+        static_assert(decltype(fn)::kCapacity == sizeof(big));
+    }
+
+    TEST(InplaceFunctionTests, ForwardsReferences)
+    {
+        inplace_function<void(std::string&)> append = [](std::string& str) { str += "!"; };
+
+        std::string text = "hi";
+        append(text);
+        ASSERT_EQ("hi!", text);
+
+        inplace_function<std::string(std::string&&)> take = [](std::string&& str) {
+            return std::move(str);
+        };
+        ASSERT_EQ("moved", take(std::string("moved")));
+    }
+
+} // namespace misc_tests
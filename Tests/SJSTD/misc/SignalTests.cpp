@@ -0,0 +1,91 @@
+// STD Headers
+#include <vector>
+
+// Library Headers
+#include "gtest/gtest.h"
+
+// Engine Headers
+
+import sj.std.signal;
+
+using namespace sj;
+
+namespace misc_tests
+{
+
+    TEST(SignalTests, EmitsInConnectionOrder)
+    {
+        signal<void(int)> sig;
+        std::vector<int> calls;
+
+        sig.connect([&calls](int value) { calls.push_back(value); });
+        sig.connect([&calls](int value) { calls.push_back(value * 10); });
+        sig.connect([&calls](int value) { calls.push_back(value * 100); });
+
+        sig.emit(2);
+        ASSERT_EQ((std::vector<int> {2, 20, 200}), calls);
+    }
+
+    TEST(SignalTests, DisconnectKeepsOrderAndRejectsStaleHandles)
+    {
+        signal<void(int)> sig;
+        std::vector<int> calls;
+
+        signal_handle first = sig.connect([&calls](int) { calls.push_back(1); });
+        signal_handle second = sig.connect([&calls](int) { calls.push_back(2); });
+        sig.connect([&calls](int) { calls.push_back(3); });
+
+        sig.disconnect(second);
+        ASSERT_FALSE(sig.is_connected(second));
+        ASSERT_TRUE(sig.is_connected(first));
+        ASSERT_EQ(2, sig.size());
+
+        // Handle index is reused, but the old handle stays dead
+        signal_handle fourth = sig.connect([&calls](int) { calls.push_back(4); });
+        ASSERT_EQ(second.index, fourth.index);
+        ASSERT_FALSE(sig.is_connected(second));
+        sig.disconnect(second);
+        ASSERT_EQ(3, sig.size());
+
+        sig.emit(0);
+        ASSERT_EQ((std::vector<int> {1, 3, 4}), calls);
+
+        sig.disconnect(first);
+        calls.clear();
+        sig.emit(0);
+        ASSERT_EQ((std::vector<int> {3, 4}), calls);
+    }
+
+    TEST(SignalTests, SlotsCanDisconnectDuringEmit)
+    {
+        signal<void()> sig;
+        int oneShotCalls = 0;
+        int persistentCalls = 0;
+
+        signal_handle oneShot;
+        oneShot = sig.connect([&]() {
+            oneShotCalls++;
+            sig.disconnect(oneShot);
+        });
+        sig.connect([&]() { persistentCalls++; });
+
+        sig.emit();
+        sig.emit();
+
+        ASSERT_EQ(1, oneShotCalls);
+        ASSERT_EQ(2, persistentCalls);
+        ASSERT_EQ(1, sig.size());
+    }
+
+    TEST(SignalTests, PassesReferences)
+    {
+        signal<void(int&)> sig;
+        sig.connect([](int& value) { value += 1; });
+        sig.connect([](int& value) { value *= 2; });
+
+        int value = 3;
+        sig.emit(value);
+        ASSERT_EQ(8, value);
+    }
+
+} // namespace misc_tests
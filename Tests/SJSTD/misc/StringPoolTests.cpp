@@ -0,0 +1,106 @@
+// STD Headers
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// Library Headers
+#include "gtest/gtest.h"
+
+// Engine Headers
+
+import sj.std.string_hash;
+import sj.std.string_pool;
+import sj.std.memory.resources.free_list_allocator;
+
+using namespace sj;
+
+namespace string_tests
+{
+
+    TEST(StringPoolTests, InternDeduplicates)
+    {
+        string_pool pool;
+
+        hashed_string_sv first = pool.intern("MoveForward");
+        hashed_string_sv second = pool.intern(std::string("MoveForward"));
+
+        ASSERT_EQ(first, second);
+        ASSERT_EQ(first.get_string().data(), second.get_string().data());
+        ASSERT_EQ("MoveForward"_strhash, first.get_hash());
+        ASSERT_EQ(1, pool.size());
+        ASSERT_EQ(std::string_view("MoveForward").size() + 1, pool.bytes_interned());
+    }
+
+    TEST(StringPoolTests, OutlivesSourceBuffer)
+    {
+        string_pool pool;
+        hashed_string_sv interned;
+
+        {
+            std::string parsed = "Scenes/TestScene";
+            interned = pool.intern(parsed);
+            parsed.assign(parsed.size(), 'x');
+        }
+
+        ASSERT_EQ("Scenes/TestScene", interned.get_string());
+
+        // Views are null terminated for C APIs
+        ASSERT_EQ('\0', interned.get_string().data()[interned.get_string().size()]);
+    }
+
+    TEST(StringPoolTests, ReverseLookup)
+    {
+        string_pool pool;
+        pool.intern("Jump");
+
+        ASSERT_TRUE(pool.contains("Jump"_strhash));
+        ASSERT_EQ("Jump", pool.find("Jump"_strhash));
+
+        ASSERT_FALSE(pool.contains("Crouch"_strhash));
+        ASSERT_TRUE(pool.find("Crouch"_strhash).empty());
+    }
+
+    TEST(StringPoolTests, UsesProvidedResource)
+    {
+        std::array<std::byte, 32768> buffer;
+        free_list_allocator resource(buffer.size(), buffer.data());
+
+        string_pool pool(&resource, 512);
+        for(int i = 0; i < 200; i++)
+            pool.intern("component_" + std::to_string(i));
+
+        ASSERT_EQ(200, pool.size());
+        ASSERT_TRUE(resource.contains_ptr(const_cast<char*>(pool.find("component_7").data())));
+    }
+
+    TEST(StringPoolTests, ConcurrentInterning)
+    {
+        string_pool pool;
+        std::vector<std::thread> threads;
+
+        for(int t = 0; t < 4; t++)
+        {
+            threads.emplace_back([&pool]() {
+                for(int i = 0; i < 500; i++)
+                    pool.intern("name_" + std::to_string(i));
+            });
+        }
+
+        for(std::thread& thread : threads)
+            thread.join();
+
+        ASSERT_EQ(500, pool.size());
+        ASSERT_EQ("name_42", pool.find(string_hash("name_42")));
+    }
+
+    TEST(StringPoolTests, GlobalPoolIsShared)
+    {
+        hashed_string_sv name = string_pool::global().intern("GlobalName");
+        ASSERT_EQ(name.get_string().data(),
+                  string_pool::global().find("GlobalName"_strhash).data());
+    }
+
+} // namespace string_tests